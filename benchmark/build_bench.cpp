@@ -0,0 +1,149 @@
+import cairn.utils.process;
+import cairn.utils.arguments;
+import cairn.utils.simple_json;
+import <chrono>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iostream>;
+import <iterator>;
+import <optional>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Measures end-to-end build of a project generated by gen_project
+//
+//usage: build_bench <cairn> <project_dir> <result.json> <jobs> <compiler> [compiler args...]
+//
+//cold  - build from scratch (build directory is erased)
+//noop  - build again, nothing has been changed
+//edit  - an exported function is appended to the interface at the bottom of
+//        the module graph (its BMI changes, so all its dependents are rebuilt).
+//        Touching the file is not enough, the content is hashed. The original
+//        content is restored at the end
+//
+//Each run collects internal statistics of cairn (--stats). The result is
+//written to the result file as a json object, so results of different commits
+//can be compared.
+
+static ArgumentString to_arg(std::string_view s) {
+    return ArgumentString(s.begin(), s.end());
+}
+
+static std::optional<Json> load_json(const std::filesystem::path &path) {
+    std::ifstream f(path);
+    if (!f) return std::nullopt;
+    try {
+        return Json::parse([&]() -> std::optional<char> {
+            int c = f.get();
+            if (c == EOF) return std::nullopt;
+            return static_cast<char>(c);
+        });
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+static std::string read_file(const std::filesystem::path &path) {
+    std::ifstream f(path, std::ios::in|std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+struct Setup {
+    std::filesystem::path cairn;
+    std::filesystem::path project;
+    std::filesystem::path build_dir;
+    std::vector<ArgumentString> compiler_args;
+    unsigned int jobs;
+};
+
+static Json run_build(const Setup &s, std::string_view name) {
+    auto stats_file = s.build_dir.parent_path()/std::format("stats_{}.json", name);
+    std::vector<ArgumentString> args = {
+        to_arg(std::format("-j{}", s.jobs)),
+        to_arg(std::format("-B{}", s.build_dir.string())),
+        to_arg(std::format("--stats={}", stats_file.string())),
+        to_arg("-f"), to_arg((s.project/"modules.yaml").string()),
+    };
+    args.insert(args.end(), s.compiler_args.begin(), s.compiler_args.end());
+
+    auto start = std::chrono::steady_clock::now();
+    auto p = Process::spawn(s.cairn, s.project, args, Process::no_streams);
+    int status = p.waitpid_status();
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << std::format("{:>8} {:>12.1f} {:>8}\n", name, ms, status);
+    Json::Object out = {
+        {"wall_ms", Json(ms)},
+        {"exit_code", Json(static_cast<double>(status))},
+    };
+    if (auto st = load_json(stats_file)) out.emplace("stats", std::move(*st));
+    return Json(std::move(out));
+}
+
+int main(int argc, char **argv) {
+    if (argc < 6) {
+        std::cerr << "Usage: build_bench <cairn> <project_dir> <result.json> <jobs> <compiler> [compiler args...]\n";
+        return 1;
+    }
+    Setup s;
+    s.cairn = std::filesystem::absolute(argv[1]);
+    s.project = std::filesystem::absolute(argv[2]);
+    std::filesystem::path result_file = argv[3];
+    s.jobs = static_cast<unsigned int>(std::strtoul(argv[4], nullptr, 10));
+    for (int i = 5; i < argc; ++i) s.compiler_args.push_back(to_arg(argv[i]));
+    s.build_dir = s.project/".bench"/"build";
+
+    auto project = load_json(s.project/"project.json");
+    if (!project) {
+        std::cerr << "Not a generated project (project.json not found): " << s.project << "\n";
+        return 1;
+    }
+    //interface at the bottom of the graph has the most dependents
+    auto &pobj = project->as_object();
+    auto edited = s.project/std::format("{}0", pobj.at("prefix").as_string())/"m0.cpp";
+
+    std::filesystem::remove_all(s.build_dir);
+    std::filesystem::create_directories(s.build_dir);
+
+    std::cout << std::format("{:>8} {:>12} {:>8}\n", "build", "wall ms", "status");
+    Json::Object runs;
+    runs.emplace("cold", run_build(s, "cold"));
+    runs.emplace("noop", run_build(s, "noop"));
+    auto original = read_file(edited);
+    {
+        std::ofstream f(edited, std::ios::out|std::ios::app);
+        f << std::format("\nexport int bench_edit_{}() {{ return 0; }}\n",
+                std::chrono::system_clock::now().time_since_epoch().count());
+    }
+    runs.emplace("edit", run_build(s, "edit"));
+    {
+        std::ofstream f(edited, std::ios::out|std::ios::trunc|std::ios::binary);
+        f << original;
+    }
+
+    std::string compiler;
+    for (int i = 5; i < argc; ++i) {
+        if (!compiler.empty()) compiler.push_back(' ');
+        compiler.append(argv[i]);
+    }
+    Json result(Json::Object{
+        {"project", std::move(*project)},
+        {"jobs", Json(static_cast<double>(s.jobs))},
+        {"compiler", Json(compiler)},
+        {"timestamp", Json(static_cast<double>(std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count()))},
+        {"runs", Json(std::move(runs))},
+    });
+    std::ofstream f(result_file, std::ios::out|std::ios::trunc);
+    if (!f) {
+        std::cerr << "Can't write: " << result_file << "\n";
+        return 1;
+    }
+    result.serialize([&](char c){f.put(c);});
+    f.put('\n');
+    return 0;
+}
@@ -0,0 +1,242 @@
+import <algorithm>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iostream>;
+import <random>;
+import <set>;
+import <sstream>;
+import <stdexcept>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Generates synthetic project using C++20 modules to benchmark cairn
+//
+//usage: gen_project <output_dir> [key=value ...]
+//
+//modules=N        count of modules (interfaces)
+//partitions=N     count of partitions of every module
+//fanout=N         count of modules imported by every module
+//depth=N          count of layers. Module imports modules only from lower layers
+//headers=N        count of generated headers
+//header_imports=N count of header units imported by every module
+//origins=N        count of directories (each has own modules.yaml, mapped by prefix)
+//prefix=name      prefix of origins and names of modules
+//functions=N      count of functions in each module (compile cost)
+//seed=N           seed of the random generator
+//
+//The generator writes modules.yaml in the output directory. Use it
+//with -f to build the project. The file project.json contains parameters
+//of the generated project.
+
+struct Params {
+    std::size_t modules = 200;
+    std::size_t partitions = 1;
+    std::size_t fanout = 4;
+    std::size_t depth = 8;
+    std::size_t headers = 16;
+    std::size_t header_imports = 2;
+    std::size_t origins = 4;
+    std::string prefix = "lib";
+    std::size_t functions = 20;
+    std::size_t seed = 12345;
+};
+
+static bool parse_param(Params &p, std::string_view arg) {
+    auto sep = arg.find('=');
+    if (sep == arg.npos) return false;
+    auto key = arg.substr(0, sep);
+    auto value = std::string(arg.substr(sep+1));
+    if (key == "prefix") {
+        p.prefix = value;
+        return true;
+    }
+    std::size_t n = std::strtoul(value.c_str(), nullptr, 10);
+    if (key == "modules") p.modules = std::max<std::size_t>(n,1);
+    else if (key == "partitions") p.partitions = n;
+    else if (key == "fanout") p.fanout = n;
+    else if (key == "depth") p.depth = std::max<std::size_t>(n,1);
+    else if (key == "headers") p.headers = n;
+    else if (key == "header_imports") p.header_imports = n;
+    else if (key == "origins") p.origins = std::max<std::size_t>(n,1);
+    else if (key == "functions") p.functions = n;
+    else if (key == "seed") p.seed = n;
+    else return false;
+    return true;
+}
+
+class Generator {
+public:
+    Generator(const Params &p, std::filesystem::path root)
+        :_p(p), _root(std::move(root)), _rnd(static_cast<std::mt19937::result_type>(p.seed)) {}
+
+    void run();
+
+protected:
+    const Params &_p;
+    std::filesystem::path _root;
+    std::mt19937 _rnd;
+
+    std::size_t layer_of(std::size_t i) const {return i * _p.depth / _p.modules;}
+    std::size_t layer_begin(std::size_t layer) const {
+        return (layer * _p.modules + _p.depth - 1) / _p.depth;
+    }
+    std::string origin_name(std::size_t i) const {return std::format("{}{}", _p.prefix, i % _p.origins);}
+    std::string module_name(std::size_t i) const {return std::format("{}.m{}", origin_name(i), i);}
+    std::filesystem::path module_dir(std::size_t i) const {return _root/origin_name(i);}
+
+    std::vector<std::size_t> pick_imports(std::size_t i);
+    std::vector<std::size_t> pick_headers();
+    void write_functions(std::ostream &out, std::string_view name);
+    void write_header(std::size_t j);
+    void write_module(std::size_t i, const std::vector<std::size_t> &imports);
+    void write_main(const std::vector<std::size_t> &top);
+    void write_config();
+};
+
+static void write_file(const std::filesystem::path &path, const std::string &content) {
+    std::ofstream f(path, std::ios::out|std::ios::trunc);
+    if (!f) throw std::runtime_error("Can't write: " + path.string());
+    f << content;
+}
+
+std::vector<std::size_t> Generator::pick_imports(std::size_t i) {
+    std::vector<std::size_t> out;
+    auto layer = layer_of(i);
+    if (layer == 0) return out;
+    auto prev = layer_begin(layer-1);
+    auto cur = layer_begin(layer);
+    std::set<std::size_t> sel;
+    //at least one import from previous layer, so the graph has requested depth
+    if (cur > prev) sel.insert(prev + _rnd() % (cur - prev));
+    std::size_t count = std::min(_p.fanout, cur);
+    while (sel.size() < count) sel.insert(_rnd() % cur);
+    out.assign(sel.begin(), sel.end());
+    return out;
+}
+
+std::vector<std::size_t> Generator::pick_headers() {
+    std::set<std::size_t> sel;
+    std::size_t count = std::min(_p.header_imports, _p.headers);
+    while (sel.size() < count) sel.insert(_rnd() % _p.headers);
+    return {sel.begin(), sel.end()};
+}
+
+void Generator::write_functions(std::ostream &out, std::string_view name) {
+    for (std::size_t k = 0; k < _p.functions; ++k) {
+        out << std::format("unsigned int {}_f{}(unsigned int x) {{\n", name, k);
+        out << std::format("    for (unsigned int i = 0; i < {}; ++i) x = x * 3 + i;\n", k + 1);
+        out << "    return x;\n}\n";
+    }
+}
+
+void Generator::write_header(std::size_t j) {
+    std::ostringstream out;
+    out << "#pragma once\n";
+    out << std::format("template<typename T>\nstruct Header{} {{\n    T value = {};\n    T get() const {{return value;}}\n}};\n", j, j);
+    out << std::format("inline unsigned int header{}_value() {{return Header{}<unsigned int>().get();}}\n", j, j);
+    write_file(_root/"include"/std::format("h{}.hpp", j), out.str());
+}
+
+void Generator::write_module(std::size_t i, const std::vector<std::size_t> &imports) {
+    auto dir = module_dir(i);
+    auto name = module_name(i);
+    auto fn = std::format("m{}", i);
+    auto headers = pick_headers();
+    std::ostringstream out;
+    out << std::format("export module {};\n\n", name);
+    for (auto h: headers) out << std::format("import \"h{}.hpp\";\n", h);
+    for (auto x: imports) out << std::format("import {};\n", module_name(x));
+    for (std::size_t q = 0; q < _p.partitions; ++q) out << std::format("export import :p{};\n", q);
+    out << "\n";
+    write_functions(out, fn);
+    out << std::format("export unsigned int {}_value() {{\n    unsigned int r = {};\n", fn, i);
+    for (auto h: headers) out << std::format("    r += header{}_value();\n", h);
+    for (auto x: imports) out << std::format("    r += m{}_value();\n", x);
+    for (std::size_t q = 0; q < _p.partitions; ++q) out << std::format("    r += {}_p{}_value();\n", fn, q);
+    for (std::size_t k = 0; k < _p.functions; ++k) out << std::format("    r += {}_f{}(r);\n", fn, k);
+    out << "    return r;\n}\n";
+    write_file(dir/std::format("{}.cpp", fn), out.str());
+
+    for (std::size_t q = 0; q < _p.partitions; ++q) {
+        std::ostringstream part;
+        part << std::format("export module {}:p{};\n\n", name, q);
+        auto pfn = std::format("{}_p{}", fn, q);
+        write_functions(part, pfn);
+        part << std::format("export unsigned int {}_value() {{\n    unsigned int r = {};\n", pfn, q);
+        for (std::size_t k = 0; k < _p.functions; ++k) part << std::format("    r += {}_f{}(r);\n", pfn, k);
+        part << "    return r;\n}\n";
+        write_file(dir/std::format("{}-p{}.cpp", fn, q), part.str());
+    }
+}
+
+void Generator::write_main(const std::vector<std::size_t> &top) {
+    std::ostringstream out;
+    out << "import <iostream>;\n";
+    for (auto x: top) out << std::format("import {};\n", module_name(x));
+    out << "\nint main() {\n    unsigned int r = 0;\n";
+    for (auto x: top) out << std::format("    r += m{}_value();\n", x);
+    out << "    std::cout << r << std::endl;\n    return 0;\n}\n";
+    write_file(_root/"main.cpp", out.str());
+}
+
+void Generator::write_config() {
+    std::ostringstream out;
+    out << "targets:\n  app: main.cpp\nfiles:\n  - main.cpp\nprefixes:\n";
+    for (std::size_t k = 0; k < std::min(_p.origins, _p.modules); ++k) {
+        out << std::format("  {}{}: {}{}\n", _p.prefix, k, _p.prefix, k);
+    }
+    write_file(_root/"modules.yaml", out.str());
+    for (std::size_t k = 0; k < std::min(_p.origins, _p.modules); ++k) {
+        write_file(_root/std::format("{}{}", _p.prefix, k)/"modules.yaml", "includes:\n  - ../include\n");
+    }
+    write_file(_root/"project.json", std::format(
+        "{{\"modules\":{},\"partitions\":{},\"fanout\":{},\"depth\":{},\"headers\":{},"
+        "\"header_imports\":{},\"origins\":{},\"prefix\":\"{}\",\"functions\":{},\"seed\":{}}}\n",
+        _p.modules, _p.partitions, _p.fanout, _p.depth, _p.headers, _p.header_imports,
+        _p.origins, _p.prefix, _p.functions, _p.seed));
+}
+
+void Generator::run() {
+    std::filesystem::create_directories(_root/"include");
+    for (std::size_t k = 0; k < std::min(_p.origins, _p.modules); ++k) {
+        std::filesystem::create_directories(_root/std::format("{}{}", _p.prefix, k));
+    }
+    for (std::size_t j = 0; j < _p.headers; ++j) write_header(j);
+    std::vector<bool> imported(_p.modules, false);
+    for (std::size_t i = 0; i < _p.modules; ++i) {
+        auto imports = pick_imports(i);
+        for (auto x: imports) imported[x] = true;
+        write_module(i, imports);
+    }
+    std::vector<std::size_t> top;
+    for (std::size_t i = 0; i < _p.modules; ++i) if (!imported[i]) top.push_back(i);
+    write_main(top);
+    write_config();
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: gen_project <output_dir> [modules=N] [partitions=N] [fanout=N] [depth=N] "
+                     "[headers=N] [header_imports=N] [origins=N] [prefix=name] [functions=N] [seed=N]\n";
+        return 1;
+    }
+    Params p;
+    for (int i = 2; i < argc; ++i) {
+        if (!parse_param(p, argv[i])) {
+            std::cerr << "Invalid parameter: " << argv[i] << "\n";
+            return 1;
+        }
+    }
+    try {
+        std::filesystem::path root = argv[1];
+        Generator(p, root).run();
+        std::cout << std::format("Generated {} modules ({} partitions each) in {}\n", p.modules, p.partitions, root.string());
+    } catch (std::exception &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
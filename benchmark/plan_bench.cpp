@@ -0,0 +1,66 @@
+import cairn.build_plan;
+import <chrono>;
+import <cstdlib>;
+import <iostream>;
+import <format>;
+import <random>;
+import <vector>;
+
+//Measures overhead of scheduling of the BuildPlan. 
+//Synthetic plan is layered graph, each target depends on several targets of previous layers
+//The benchmark emulates Builder - it dispatches ready targets and marks them done one by one
+
+
+struct DummyAction {
+    std::size_t id;
+};
+
+static BuildPlan<DummyAction> create_synthetic_plan(std::size_t targets, std::size_t deps, std::size_t width) {
+    std::mt19937 rnd(12345);
+    BuildPlan<DummyAction> plan;
+    for (std::size_t i = 0; i < targets; ++i) {
+        auto id = plan.create_target({i}, std::to_string(i), 1 + rnd() % 1000);
+        std::size_t layer_start = (i / width) * width;
+        if (layer_start == 0) continue;
+        for (std::size_t j = 0; j < deps; ++j) {
+            plan.add_dependency(id, rnd() % layer_start);
+        }
+    }
+    return plan;
+}
+
+static void run_benchmark(std::size_t targets, std::size_t deps, std::size_t width, std::size_t in_flight) {
+    auto plan = create_synthetic_plan(targets, deps, width);
+    auto start = std::chrono::steady_clock::now();
+    auto state = plan.initialize_state();
+    std::vector<std::size_t> running;
+    std::size_t completed = 0;
+    while (true) {
+        bool done = plan.prepare_actions(state, [&](auto id, const DummyAction &){
+            if (running.size() >= in_flight) return false;
+            running.push_back(id);
+            return true;
+        });
+        if (done) break;
+        //complete the oldest action
+        plan.mark_done(state, running.front());
+        running.erase(running.begin());
+        ++completed;
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << std::format("{:>8} {:>6} {:>6} {:>6} {:>12.3f} {:>12.1f}\n",
+        targets, deps, width, in_flight, ns / 1e6, static_cast<double>(ns) / static_cast<double>(completed));
+}
+
+int main(int argc, char **argv) {
+    std::size_t max_targets = argc > 1?std::strtoul(argv[1], nullptr, 10):20000;
+    std::cout << std::format("{:>8} {:>6} {:>6} {:>6} {:>12} {:>12}\n",
+        "targets", "deps", "width", "jobs", "total ms", "ns/target");
+    for (std::size_t n = 1000; n <= max_targets; n *= 2) {
+        run_benchmark(n, 8, 64, 16);
+    }
+    run_benchmark(max_targets, 32, 64, 16);
+    run_benchmark(max_targets, 8, 1024, 256);
+    return 0;
+}
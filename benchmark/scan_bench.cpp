@@ -0,0 +1,129 @@
+import cairn.preprocess;
+import cairn.source_scanner;
+import <atomic>;
+import <chrono>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iostream>;
+import <new>;
+import <string>;
+import <string_view>;
+
+//Measures throughput of the scanner (MB/s of source text) and count of heap allocations
+//Synthetic sources are generated into a temporary directory
+//
+//plain     - code without comments and continuations
+//comments  - every line has a comment, some of them are block comments
+//preamble  - module unit with global module fragment and imports followed by large body
+//imports   - as preamble, without global module fragment
+//directives - conditions, macro definitions and expansions
+//
+//preproc   - full preprocessing of the file (--preproc)
+//scan      - SourceScanner over already preprocessed text
+//stream    - preprocessing stopped at end of the module preamble
+//tiered    - as stream, but the preprocessor is skipped, when there is no directive (used by discovery)
+
+
+static std::atomic<std::size_t> allocations = 0;
+
+void *operator new(std::size_t sz) {
+    ++allocations;
+    if (void *p = std::malloc(sz?sz:1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete(void *p, std::size_t) noexcept {std::free(p);}
+
+static std::string generate(std::string_view kind, std::size_t size) {
+    std::string out;
+    out.reserve(size + 1024);
+    if (kind == "directives") {
+        out.append("#define OFFSET 10\n#define CHECK(x) ((x) * 2 > OFFSET)\n#define FEATURE_3 1\n");
+    } else if (kind == "preamble") {
+        out.append("module;\n#define TABLE_SIZE 1\nexport module tables;\n");
+    } else if (kind == "imports") {
+        out.append("export module tables;\n");
+    }
+    if (kind == "preamble" || kind == "imports") {
+        for (int i = 0; i < 20; ++i) out.append(std::format("import dep{};\n", i));
+        out.append("export const int table[] = {\n");
+    }
+    std::size_t n = 0;
+    while (out.size() < size) {
+        if (kind == "directives") {
+            out.append(std::format("#define VALUE_{} ({} + OFFSET)\n", n % 64, n));
+            out.append(std::format("#if defined(FEATURE_{}) && VALUE_{} > 100 || CHECK(VALUE_{})\n", n % 16, n % 64, n % 32));
+            out.append(std::format("int enabled_{};\n#elif !defined(CHECK)\n#else\nint disabled_{};\n#endif\n", n, n));
+        } else if (kind == "comments") {
+            if (n % 8 == 0) out.append("/* block comment\n   continues here */\n");
+            out.append(std::format("int value_{} = {} / 3; // comment of line {}\n", n, n, n));
+        } else {
+            out.append(std::format("    {}, {}, {}, {}, {}, {}, {}, {},\n", n, n+1, n+2, n+3, n+4, n+5, n+6, n+7));
+        }
+        ++n;
+    }
+    if (kind == "preamble" || kind == "imports") out.append("0};\n");
+    return out;
+}
+
+template<typename Fn>
+static void measure(std::string_view kind, std::string_view mode, std::size_t bytes, unsigned int repeat, Fn &&fn) {
+    auto best = std::chrono::steady_clock::duration::max();
+    std::size_t allocs = 0;
+    for (unsigned int i = 0; i < repeat; ++i) {
+        auto a = allocations.load();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+        allocs = allocations.load() - a;
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(best).count();
+    double mbs = us?static_cast<double>(bytes) / static_cast<double>(us):0.0;
+    std::cout << std::format("{:>10} {:>8} {:>10.1f} {:>12.3f} {:>10.1f} {:>12}\n",
+        kind, mode, bytes / 1048576.0, us / 1000.0, mbs, allocs);
+}
+
+int main(int argc, char **argv) {
+    std::size_t mb = argc > 1?std::strtoul(argv[1], nullptr, 10):16;
+    unsigned int repeat = argc > 2?static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)):5;
+    auto dir = std::filesystem::temp_directory_path()/"cairn_scan_bench";
+    std::filesystem::create_directories(dir);
+
+    std::cout << std::format("{:>10} {:>8} {:>10} {:>12} {:>10} {:>12}\n", "source", "mode", "MB", "best ms", "MB/s", "allocations");
+    for (std::string_view kind: {"plain", "comments", "preamble", "imports", "directives"}) {
+        auto text = generate(kind, mb * 1048576);
+        auto file = dir/std::format("{}.cpp", kind);
+        std::ofstream(file, std::ios::out|std::ios::trunc|std::ios::binary) << text;
+
+        std::string preprocessed;
+        measure(kind, "preproc", text.size(), repeat, [&]{
+            StupidPreprocessor pp;
+            preprocessed = pp.run(dir, file);
+        });
+        measure(kind, "scan", preprocessed.size(), repeat, [&]{
+            SourceScanner::scan_string(preprocessed);
+        });
+        measure(kind, "stream", text.size(), repeat, [&]{
+            StupidPreprocessor pp;
+            SourceScanner::Preamble preamble;
+            pp.run(dir, file, [&](std::string_view ln){return preamble.add_line(ln);});
+            preamble.result();
+        });
+        measure(kind, "tiered", text.size(), repeat, [&]{
+            StupidPreprocessor pp;
+            std::string content;
+            StupidPreprocessor::read_source(file, content);
+            SourceScanner::Preamble preamble;
+            auto sink = [&](std::string_view ln){return preamble.add_line(ln);};
+            if (!pp.copy_plain(dir, content, sink)) {
+                preamble = {};
+                pp.copy(dir, content, sink);
+            }
+            preamble.result();
+        });
+    }
+    std::filesystem::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,105 @@
+import cairn.utils.process;
+import cairn.utils.arguments;
+import <atomic>;
+import <chrono>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <iostream>;
+import <mutex>;
+import <span>;
+import <string>;
+import <condition_variable>;
+import <thread>;
+import <vector>;
+
+//Measures throughput of spawning processes. The spawned program is trivial
+//(default /bin/true), so the result is dominated by the cost of the spawn itself.
+//Each spawn has a compiler-like command line and its own working directory
+//
+//threads - several threads spawn and wait for process synchronously
+//monitor - one thread spawns, ProcessMonitor waits, N processes in flight
+
+static std::vector<ArgumentString> create_arguments(std::size_t count) {
+    std::vector<ArgumentString> out;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto s = std::format("-I/some/long/path/to/include/directory/number_{}", i);
+        out.push_back(ArgumentString(s.begin(), s.end()));
+    }
+    return out;
+}
+
+static void print_result(std::string_view mode, std::size_t par, std::size_t count,
+                        std::chrono::steady_clock::duration total,
+                        std::chrono::steady_clock::duration spawn_time) {
+    auto total_ms = std::chrono::duration_cast<std::chrono::microseconds>(total).count() / 1000.0;
+    auto spawn_us = std::chrono::duration_cast<std::chrono::nanoseconds>(spawn_time).count() / 1000.0;
+    std::cout << std::format("{:>8} {:>6} {:>8} {:>12.1f} {:>12.0f} {:>14.1f}\n",
+        mode, par, count, total_ms, count * 1000.0 / total_ms, spawn_us / static_cast<double>(count));
+}
+
+static void run_threads(const std::filesystem::path &program, const std::filesystem::path &workdir,
+                        std::span<const ArgumentString> args, std::size_t threads, std::size_t count) {
+    std::atomic<std::size_t> started = 0;
+    std::atomic<std::chrono::steady_clock::rep> spawn_time = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::jthread> thr;
+    for (std::size_t i = 0; i < threads; ++i) {
+        thr.emplace_back([&]{
+            while (started.fetch_add(1) < count) {
+                auto s = std::chrono::steady_clock::now();
+                auto p = Process::spawn(program, workdir, args, Process::no_streams);
+                spawn_time += (std::chrono::steady_clock::now() - s).count();
+                p.waitpid_status();
+            }
+        });
+    }
+    thr.clear();
+    print_result("threads", threads, count, std::chrono::steady_clock::now() - start,
+                std::chrono::steady_clock::duration(spawn_time.load()));
+}
+
+static void run_monitor(const std::filesystem::path &program, const std::filesystem::path &workdir,
+                        std::span<const ArgumentString> args, std::size_t in_flight, std::size_t count) {
+    std::mutex mx;
+    std::condition_variable cond;
+    std::size_t running = 0;
+    std::size_t finished = 0;
+    std::chrono::steady_clock::duration spawn_time = {};
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::unique_lock lk(mx);
+        cond.wait(lk, [&]{return running < in_flight;});
+        ++running;
+        lk.unlock();
+        auto s = std::chrono::steady_clock::now();
+        auto p = Process::spawn(program, workdir, args, Process::no_streams);
+        spawn_time += std::chrono::steady_clock::now() - s;
+        ProcessMonitor::instance().watch(std::move(p), [&](int, std::string, std::size_t){
+            std::lock_guard _(mx);
+            --running;
+            ++finished;
+            cond.notify_all();
+        });
+    }
+    std::unique_lock lk(mx);
+    cond.wait(lk, [&]{return finished == count;});
+    print_result("monitor", in_flight, count, std::chrono::steady_clock::now() - start, spawn_time);
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1?std::strtoul(argv[1], nullptr, 10):2000;
+    std::filesystem::path program = argc > 2?argv[2]:"/bin/true";
+    auto workdir = std::filesystem::temp_directory_path();
+    auto args = create_arguments(200);
+
+    std::cout << std::format("{:>8} {:>6} {:>8} {:>12} {:>12} {:>14}\n",
+        "mode", "jobs", "spawns", "total ms", "spawns/s", "us/spawn call");
+    for (std::size_t n = 1; n <= 32; n *= 2) {
+        run_threads(program, workdir, args, n, count);
+    }
+    for (std::size_t n = 1; n <= 32; n *= 2) {
+        run_monitor(program, workdir, args, n, count);
+    }
+    return 0;
+}
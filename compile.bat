@@ -1,263 +1,323 @@
 @echo off
-SET CXX=cl.exe
-IF NOT "%1" == ""  SET CXX=%1
+SET CLANG=cl.exe
+IF NOT "%1" == ""  SET CLANG=%1
 goto :init
 
 :compile
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\iostream_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\iostream_cbf29ce484222325.ifc iostream
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\algorithm_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\algorithm_0.ifc algorithm
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\variant_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\variant_cbf29ce484222325.ifc variant
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\iostream_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\iostream_0.ifc iostream
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\memory_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\memory_cbf29ce484222325.ifc memory
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\string_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\string_0.ifc string
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\filesystem_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\filesystem_cbf29ce484222325.ifc filesystem
-popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\charconv_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc charconv
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\charconv_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\charconv_0.ifc charconv
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\unordered_map_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc unordered_map
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\vector_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\vector_0.ifc vector
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\sstream_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\sstream_cbf29ce484222325.ifc sstream
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\exception_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\exception_0.ifc exception
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\string_view_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\string_view_cbf29ce484222325.ifc string_view
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\optional_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\optional_0.ifc optional
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\format_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\format_cbf29ce484222325.ifc format
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\unordered_map_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\unordered_map_0.ifc unordered_map
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\vector_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\vector_cbf29ce484222325.ifc vector
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\format_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\format_0.ifc format
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\span_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\span_cbf29ce484222325.ifc span
-popd
-pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\type_traits_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\type_traits_cbf29ce484222325.ifc type_traits
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\variant_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\variant_0.ifc variant
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cstddef_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc cstddef
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cwctype_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cwctype_0.ifc cwctype
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\string_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\string_cbf29ce484222325.ifc string
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\map_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\map_0.ifc map
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\algorithm_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\algorithm_cbf29ce484222325.ifc algorithm
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\system_error_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\system_error_0.ifc system_error
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\functional_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\functional_cbf29ce484222325.ifc functional
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\fstream_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\fstream_0.ifc fstream
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\array_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\array_cbf29ce484222325.ifc array
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\atomic_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\atomic_0.ifc atomic
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\mutex_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\mutex_cbf29ce484222325.ifc mutex
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\filesystem_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\filesystem_0.ifc filesystem
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\system_error_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\system_error_cbf29ce484222325.ifc system_error
-popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cwctype_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc cwctype
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\mutex_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\mutex_0.ifc mutex
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\map_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\map_cbf29ce484222325.ifc map
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cstdint_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\cstdint_0.ifc cstdint
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\exception_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\exception_cbf29ce484222325.ifc exception
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\deque_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\deque_0.ifc deque
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\fstream_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\fstream_cbf29ce484222325.ifc fstream
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\chrono_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\chrono_0.ifc chrono
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\optional_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\optional_cbf29ce484222325.ifc optional
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\string_view_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\string_view_0.ifc string_view
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\ostream_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\ostream_cbf29ce484222325.ifc ostream
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\ostream_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\ostream_0.ifc ostream
 popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\streambuf_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc streambuf
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\span_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\span_0.ifc span
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\set_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\set_cbf29ce484222325.ifc set
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\utility_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\utility_0.ifc utility
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\concepts_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\concepts_cbf29ce484222325.ifc concepts
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\streambuf_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\streambuf_0.ifc streambuf
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\atomic_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\atomic_cbf29ce484222325.ifc atomic
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\type_traits_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\type_traits_0.ifc type_traits
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\chrono_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\chrono_cbf29ce484222325.ifc chrono
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\functional_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\functional_0.ifc functional
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\iterator_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\iterator_cbf29ce484222325.ifc iterator
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\array_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\array_0.ifc array
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\queue_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\queue_cbf29ce484222325.ifc queue
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\thread_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\thread_0.ifc thread
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\utility_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\utility_cbf29ce484222325.ifc utility
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\unordered_set_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\unordered_set_0.ifc unordered_set
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\bit_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\bit_0.ifc bit
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cstddef_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cstddef_0.ifc cstddef
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cstring_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cstring_0.ifc cstring
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\unordered_set_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc unordered_set
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\tuple_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\tuple_0.ifc tuple
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\ranges_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\ranges_cbf29ce484222325.ifc ranges
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\memory_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\memory_0.ifc memory
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\concepts_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\concepts_0.ifc concepts
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cctype_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\cctype_cbf29ce484222325.ifc cctype
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\stdexcept_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\stdexcept_0.ifc stdexcept
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\stdexcept_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc stdexcept
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\set_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\set_0.ifc set
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cstdint_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cstdint_cbf29ce484222325.ifc cstdint
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\utf_8_9a8dee51f130cf79.pdb /c /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.utf8.ifc /Fo..\..\..\.install\obj\utf_8_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\utf_8.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\thread_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\thread_cbf29ce484222325.ifc thread
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\sstream_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\sstream_0.ifc sstream
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\condition_variable_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc condition_variable
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\simple_json_9a8dee51f130cf79.pdb /c /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.simple_json.ifc /Fo..\..\..\.install\obj\simple_json_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\simple_json.cpp
 popd
-pushd src\cairn\compilers\clang
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\regex_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\..\.install\ifc\regex_cbf29ce484222325.ifc regex
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\env_9a8dee51f130cf79.pdb /c /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.env.ifc /Fo..\..\..\.install\obj\env_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\env.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\numeric_cbf29ce484222325.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\numeric_cbf29ce484222325.ifc numeric
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\stats_9a8dee51f130cf79.pdb /c /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle deque=..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle atomic=..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle ostream=..\..\..\.install\ifc\ostream_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.stats.ifc /Fo..\..\..\.install\obj\stats_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\stats.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\origin_env_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.origin_env.ifc /Fo..\..\.install\obj\origin_env_2d411b6e0cf5dfe1.obj ..\..\src\cairn\origin_env.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\iterator_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\iterator_0.ifc iterator
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\arguments_918ff8ed1f1535e2.pdb /c /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\.install\ifc\span_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.arguments.ifc /Fo..\..\..\.install\obj\arguments_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\arguments.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\arguments_9a8dee51f130cf79.pdb /c /headerUnit:angle span=..\..\..\.install\ifc\span_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.arguments.ifc /Fo..\..\..\.install\obj\arguments_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\arguments.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\thread_pool_918ff8ed1f1535e2.pdb /c /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.threadpool.ifc /Fo..\..\..\.install\obj\thread_pool_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\thread_pool.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\fd_streambuf_9a8dee51f130cf79.pdb /c /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.fd_streambuf.ifc /Fo..\..\..\.install\obj\fd_streambuf_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\fd_streambuf.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\log.ifc_918ff8ed1f1535e2.pdb /c /headerUnit:angle array=..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.log.ifc /Fo..\..\..\.install\obj\log.ifc_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\log.ifc.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\log.ifc_9a8dee51f130cf79.pdb /c /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.log.ifc /Fo..\..\..\.install\obj\log.ifc_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\log.ifc.cpp
 popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\log_918ff8ed1f1535e2.pdb /c /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /Fo..\..\..\.install\obj\log_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\log.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cstdlib_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\cstdlib_0.ifc cstdlib
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\queue_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\queue_0.ifc queue
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\version_918ff8ed1f1535e2.pdb /c /headerUnit:angle sstream=..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.version.ifc /Fo..\..\..\.install\obj\version_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\version.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\process_win_9a8dee51f130cf79.pdb /c /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle span=..\..\..\.install\ifc\span_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle ostream=..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle unordered_set=..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_0.ifc /internalPartition /ifcOutput ..\..\..\.install\ifc\cairn.utils.process-win.ifc /Fo..\..\..\.install\obj\process_win_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\process_win.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_type_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_type.ifc /Fo..\..\.install\obj\module_type_2d411b6e0cf5dfe1.obj ..\..\src\cairn\module_type.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_type_f4ce731b09f65819.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_type.ifc /Fo..\..\.install\obj\module_type_f4ce731b09f65819.obj ..\..\src\cairn\module_type.cpp
 popd
-pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\build_plan_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.build_plan.ifc /Fo..\..\.install\obj\build_plan_2d411b6e0cf5dfe1.obj ..\..\src\cairn\build_plan.cpp
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\hash_9a8dee51f130cf79.pdb /c /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cstring=..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cstddef=..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle bit=..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.hash.ifc /Fo..\..\..\.install\obj\hash_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\hash.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\preprocess.ifc_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.preprocess.ifc /Fo..\..\.install\obj\preprocess.ifc_2d411b6e0cf5dfe1.obj ..\..\src\cairn\preprocess.ifc.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\scanner_f4ce731b09f65819.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.source_scanner.ifc /Fo..\..\.install\obj\scanner_f4ce731b09f65819.obj ..\..\src\cairn\scanner.cpp
 popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\utf_8_918ff8ed1f1535e2.pdb /c /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.utf8.ifc /Fo..\..\..\.install\obj\utf_8_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\utf_8.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cctype_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\cctype_0.ifc cctype
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\function_view_918ff8ed1f1535e2.pdb /c /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.function_view.ifc /Fo..\..\..\.install\obj\function_view_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\function_view.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\serializer_9a8dee51f130cf79.pdb /c /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle stdexcept=..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle set=..\..\..\.install\ifc\set_0.ifc /headerUnit:angle memory=..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle concepts=..\..\..\.install\ifc\concepts_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.serializer.ifc /Fo..\..\..\.install\obj\serializer_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\serializer.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\env_918ff8ed1f1535e2.pdb /c /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.env.ifc /Fo..\..\..\.install\obj\env_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\env.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\function_view_9a8dee51f130cf79.pdb /c /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.function_view.ifc /Fo..\..\..\.install\obj\function_view_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\function_view.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\version_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.version.ifc /Fo..\..\.install\obj\version_2d411b6e0cf5dfe1.obj ..\..\src\cairn\version.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_commands_supp.ifc_f4ce731b09f65819.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.compile_commands.ifc /Fo..\..\.install\obj\compile_commands_supp.ifc_f4ce731b09f65819.obj ..\..\src\cairn\compile_commands_supp.ifc.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_target_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.compile_target.ifc /Fo..\..\.install\obj\compile_target_2d411b6e0cf5dfe1.obj ..\..\src\cairn\compile_target.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\origin_env_f4ce731b09f65819.pdb /c /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.origin_env.ifc /Fo..\..\.install\obj\origin_env_f4ce731b09f65819.obj ..\..\src\cairn\origin_env.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\serializer_918ff8ed1f1535e2.pdb /c /headerUnit:angle concepts=..\..\..\.install\ifc\concepts_cbf29ce484222325.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle set=..\..\..\.install\ifc\set_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\..\.install\ifc\utility_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.serializer.ifc /Fo..\..\..\.install\obj\serializer_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\serializer.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\cerrno_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\cerrno_0.ifc cerrno
 popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\serialization_rules_918ff8ed1f1535e2.pdb /c /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.serializer.rules.ifc /Fo..\..\..\.install\obj\serialization_rules_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\serialization_rules.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\source_def_f4ce731b09f65819.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.source_def.ifc /Fo..\..\.install\obj\source_def_f4ce731b09f65819.obj ..\..\src\cairn\source_def.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\hash_918ff8ed1f1535e2.pdb /c /headerUnit:angle cstddef=..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.hash.ifc /Fo..\..\..\.install\obj\hash_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\hash.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\process_9a8dee51f130cf79.pdb /c /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle deque=..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle span=..\..\..\.install\ifc\span_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle ostream=..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle utility=..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle unordered_set=..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.process.ifc /Fo..\..\..\.install\obj\process_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\process.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\simple_json_918ff8ed1f1535e2.pdb /c /headerUnit:angle variant=..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.simple_json.ifc /Fo..\..\..\.install\obj\simple_json_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\simple_json.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\serialization_rules_9a8dee51f130cf79.pdb /c /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.serializer.rules.ifc /Fo..\..\..\.install\obj\serialization_rules_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\serialization_rules.cpp
 popd
-pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\fd_streambuf_918ff8ed1f1535e2.pdb /c /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.fd_streambuf.ifc /Fo..\..\..\.install\obj\fd_streambuf_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\fd_streambuf.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\condition_variable_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\condition_variable_0.ifc condition_variable
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\abstract_compiler_f4ce731b09f65819.pdb /c /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.abstract_compiler.ifc /Fo..\..\.install\obj\abstract_compiler_f4ce731b09f65819.obj ..\..\src\cairn\abstract_compiler.cpp
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\remote_protocol_f4ce731b09f65819.pdb /c /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.remote.protocol.ifc /Fo..\..\.install\obj\remote_protocol_f4ce731b09f65819.obj ..\..\src\cairn\remote_protocol.cpp
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\limits_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\limits_0.ifc limits
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_commands_supp.ifc_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.compile_commands.ifc /Fo..\..\.install\obj\compile_commands_supp.ifc_2d411b6e0cf5dfe1.obj ..\..\src\cairn\compile_commands_supp.ifc.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\ranges_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\ranges_0.ifc ranges
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\source_def_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.source_def.ifc /Fo..\..\.install\obj\source_def_2d411b6e0cf5dfe1.obj ..\..\src\cairn\source_def.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\random_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\.install\ifc\random_0.ifc random
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\numeric_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\.install\ifc\numeric_0.ifc numeric
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cli_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.cli.ifc /Fo..\..\.install\obj\cli_2d411b6e0cf5dfe1.obj ..\..\src\cairn\cli.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\remote_executor_f4ce731b09f65819.pdb /c /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.remote.executor.ifc /Fo..\..\.install\obj\remote_executor_f4ce731b09f65819.obj ..\..\src\cairn\remote_executor.cpp
+popd
+pushd src\cairn\compilers\clang
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\regex_0.pdb /c /exportHeader /headerName:angle /ifcOutput ..\..\..\..\.install\ifc\regex_0.ifc regex
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\preprocess_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /Fo..\..\.install\obj\preprocess_2d411b6e0cf5dfe1.obj ..\..\src\cairn\preprocess.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\artifact_cache_f4ce731b09f65819.pdb /c /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.artifact_cache.ifc /Fo..\..\.install\obj\artifact_cache_f4ce731b09f65819.obj ..\..\src\cairn\artifact_cache.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\scanner_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.source_scanner.ifc /Fo..\..\.install\obj\scanner_2d411b6e0cf5dfe1.obj ..\..\src\cairn\scanner.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\build_plan_f4ce731b09f65819.pdb /c /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.build_plan.ifc /Fo..\..\.install\obj\build_plan_f4ce731b09f65819.obj ..\..\src\cairn\build_plan.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_commands_supp_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /Fo..\..\.install\obj\compile_commands_supp_2d411b6e0cf5dfe1.obj ..\..\src\cairn\compile_commands_supp.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_target_f4ce731b09f65819.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.compile_target.ifc /Fo..\..\.install\obj\compile_target_f4ce731b09f65819.obj ..\..\src\cairn\compile_target.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_resolver.ifc_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_resolver.ifc /Fo..\..\.install\obj\module_resolver.ifc_2d411b6e0cf5dfe1.obj ..\..\src\cairn\module_resolver.ifc.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_resolver.ifc_f4ce731b09f65819.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_resolver.ifc /Fo..\..\.install\obj\module_resolver.ifc_f4ce731b09f65819.obj ..\..\src\cairn\module_resolver.ifc.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_resolver_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /Fo..\..\.install\obj\module_resolver_2d411b6e0cf5dfe1.obj ..\..\src\cairn\module_resolver.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_database.ifc_f4ce731b09f65819.pdb /c /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_database.ifc /Fo..\..\.install\obj\module_database.ifc_f4ce731b09f65819.obj ..\..\src\cairn\module_database.ifc.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\process_win_918ff8ed1f1535e2.pdb /c /headerUnit:angle span=..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_cbf29ce484222325.ifc /internalPartition /ifcOutput ..\..\..\.install\ifc\cairn.utils.process-win.ifc /Fo..\..\..\.install\obj\process_win_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\process_win.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\jobserver_9a8dee51f130cf79.pdb /c /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle cstdlib=..\..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle memory=..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle cerrno=..\..\..\.install\ifc\cerrno_0.ifc /headerUnit:angle stdexcept=..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.jobserver.ifc /Fo..\..\..\.install\obj\jobserver_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\jobserver.cpp
 popd
 pushd src\cairn\utils
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\process_918ff8ed1f1535e2.pdb /c /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\.install\ifc\map_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.process.ifc /Fo..\..\..\.install\obj\process_918ff8ed1f1535e2.obj ..\..\..\src\cairn\utils\process.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\trace_9a8dee51f130cf79.pdb /c /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle ostream=..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle atomic=..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.trace.ifc /Fo..\..\..\.install\obj\trace_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\trace.cpp
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\thread_pool_9a8dee51f130cf79.pdb /c /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle condition_variable=..\..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle queue=..\..\..\.install\ifc\queue_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle memory=..\..\..\.install\ifc\memory_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.threadpool.ifc /Fo..\..\..\.install\obj\thread_pool_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\thread_pool.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\gnu_compiler_setup_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.gnu_compiler_setup.ifc /Fo..\..\.install\obj\gnu_compiler_setup_2d411b6e0cf5dfe1.obj ..\..\src\cairn\gnu_compiler_setup.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\preprocess.ifc_f4ce731b09f65819.pdb /c /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.preprocess.ifc /Fo..\..\.install\obj\preprocess.ifc_f4ce731b09f65819.obj ..\..\src\cairn\preprocess.ifc.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\abstract_compiler_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.abstract_compiler.ifc /Fo..\..\.install\obj\abstract_compiler_2d411b6e0cf5dfe1.obj ..\..\src\cairn\abstract_compiler.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\version_f4ce731b09f65819.pdb /c /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.version.ifc /Fo..\..\.install\obj\version_f4ce731b09f65819.obj ..\..\src\cairn\version.cpp
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\load_monitor_9a8dee51f130cf79.pdb /c /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.load_monitor.ifc /Fo..\..\..\.install\obj\load_monitor_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\load_monitor.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\builder_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.builder.ifc /Fo..\..\.install\obj\builder_2d411b6e0cf5dfe1.obj ..\..\src\cairn\builder.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\cli_f4ce731b09f65819.pdb /c /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.cli.ifc /Fo..\..\.install\obj\cli_f4ce731b09f65819.obj ..\..\src\cairn\cli.cpp
 popd
-pushd src\cairn\compilers\gcc
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_5302eba07b1e93de.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.gcc.ifc /Fo..\..\..\..\.install\obj\factory_5302eba07b1e93de.obj ..\..\..\..\src\cairn\compilers\gcc\factory.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_database_f4ce731b09f65819.pdb /c /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /Fo..\..\.install\obj\module_database_f4ce731b09f65819.obj ..\..\src\cairn\module_database.cpp
 popd
-pushd src\cairn\compilers\gcc
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_gcc_5302eba07b1e93de.pdb /c /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle regex=..\..\..\..\.install\ifc\regex_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /Fo..\..\..\..\.install\obj\compiler_gcc_5302eba07b1e93de.obj ..\..\..\..\src\cairn\compilers\gcc\compiler_gcc.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\builder_f4ce731b09f65819.pdb /c /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle cerrno=..\..\.install\ifc\cerrno_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.builder.ifc /Fo..\..\.install\obj\builder_f4ce731b09f65819.obj ..\..\src\cairn\builder.cpp
 popd
-pushd src\cairn\compilers\msvc
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_cb092f21b751850a.pdb /c /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.msvc.ifc /Fo..\..\..\..\.install\obj\factory_cb092f21b751850a.obj ..\..\..\..\src\cairn\compilers\msvc\factory.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\p1689_scanner_f4ce731b09f65819.pdb /c /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.p1689_scanner.ifc /Fo..\..\.install\obj\p1689_scanner_f4ce731b09f65819.obj ..\..\src\cairn\p1689_scanner.cpp
 popd
-pushd src\cairn\compilers\msvc
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_msvc_cb092f21b751850a.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle numeric=..\..\..\..\.install\ifc\numeric_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle concepts=..\..\..\..\.install\ifc\concepts_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle set=..\..\..\..\.install\ifc\set_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /Fo..\..\..\..\.install\obj\compiler_msvc_cb092f21b751850a.obj ..\..\..\..\src\cairn\compilers\msvc\compiler_msvc.cpp
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\worker_f4ce731b09f65819.pdb /c /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle random=..\..\.install\ifc\random_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.worker.ifc /Fo..\..\.install\obj\worker_f4ce731b09f65819.obj ..\..\src\cairn\worker.cpp
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\preprocess_f4ce731b09f65819.pdb /c /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /Fo..\..\.install\obj\preprocess_f4ce731b09f65819.obj ..\..\src\cairn\preprocess.cpp
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\file_watcher_9a8dee51f130cf79.pdb /c /headerUnit:angle fstream=..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle ostream=..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle optional=..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle variant=..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle string_view=..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle chrono=..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle atomic=..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle deque=..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle exception=..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle span=..\..\..\.install\ifc\span_0.ifc /headerUnit:angle system_error=..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle thread=..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\.install\ifc\unordered_map_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.file_watcher.ifc /Fo..\..\..\.install\obj\file_watcher_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\file_watcher.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_database.ifc_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.module_database.ifc /Fo..\..\.install\obj\module_database.ifc_2d411b6e0cf5dfe1.obj ..\..\src\cairn\module_database.ifc.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\script_build_f4ce731b09f65819.pdb /c /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.script_build.ifc /Fo..\..\.install\obj\script_build_f4ce731b09f65819.obj ..\..\src\cairn\script_build.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_database_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_cbf29ce484222325.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle set=..\..\.install\ifc\set_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /Fo..\..\.install\obj\module_database_2d411b6e0cf5dfe1.obj ..\..\src\cairn\module_database.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\gnu_compiler_setup_f4ce731b09f65819.pdb /c /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.gnu_compiler_setup.ifc /Fo..\..\.install\obj\gnu_compiler_setup_f4ce731b09f65819.obj ..\..\src\cairn\gnu_compiler_setup.cpp
+popd
+pushd src\cairn\compilers\msvc
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_d52495085800088b.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.msvc.ifc /Fo..\..\..\..\.install\obj\factory_d52495085800088b.obj ..\..\..\..\src\cairn\compilers\msvc\factory.cpp
+popd
+pushd src\cairn\compilers\gcc
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_4b9f900a6746ec2b.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.gcc.ifc /Fo..\..\..\..\.install\obj\factory_4b9f900a6746ec2b.obj ..\..\..\..\src\cairn\compilers\gcc\factory.cpp
+popd
+pushd src\cairn\compilers\fake
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_6d1f761ca92595d0.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.fake.ifc /Fo..\..\..\..\.install\obj\factory_6d1f761ca92595d0.obj ..\..\..\..\src\cairn\compilers\fake\factory.cpp
 popd
 pushd src\cairn\compilers\clang
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_b3facd1c9e22fb76.pdb /c /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.clang.ifc /Fo..\..\..\..\.install\obj\factory_b3facd1c9e22fb76.obj ..\..\..\..\src\cairn\compilers\clang\factory.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\factory_2f01e9763865527e.pdb /c /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /interface /ifcOutput ..\..\..\..\.install\ifc\cairn.compiler.clang.ifc /Fo..\..\..\..\.install\obj\factory_2f01e9763865527e.obj ..\..\..\..\src\cairn\compilers\clang\factory.cpp
+popd
+pushd src\cairn\compilers\msvc
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_msvc_d52495085800088b.pdb /c /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle limits=..\..\..\..\.install\ifc\limits_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle set=..\..\..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle concepts=..\..\..\..\.install\ifc\concepts_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle numeric=..\..\..\..\.install\ifc\numeric_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /Fo..\..\..\..\.install\obj\compiler_msvc_d52495085800088b.obj ..\..\..\..\src\cairn\compilers\msvc\compiler_msvc.cpp
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\version_9a8dee51f130cf79.pdb /c /headerUnit:angle string=..\..\..\.install\ifc\string_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle sstream=..\..\..\.install\ifc\sstream_0.ifc /interface /ifcOutput ..\..\..\.install\ifc\cairn.utils.version.ifc /Fo..\..\..\.install\obj\version_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\version.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\script_build_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle set=..\..\.install\ifc\set_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /interface /ifcOutput ..\..\.install\ifc\cairn.script_build.ifc /Fo..\..\.install\obj\script_build_2d411b6e0cf5dfe1.obj ..\..\src\cairn\script_build.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\main_f4ce731b09f65819.pdb /c /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle limits=..\..\.install\ifc\limits_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle numeric=..\..\.install\ifc\numeric_0.ifc /headerUnit:angle cstdlib=..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_0.ifc /headerUnit:angle regex=..\..\.install\ifc\regex_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle map=..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_0.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle random=..\..\.install\ifc\random_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_0.ifc /headerUnit:angle set=..\..\.install\ifc\set_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\.install\ifc\tuple_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cerrno=..\..\.install\ifc\cerrno_0.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_0.ifc /Fo..\..\.install\obj\main_f4ce731b09f65819.obj ..\..\src\cairn\main.cpp
 popd
 pushd src\cairn\compilers\clang
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_clang_b3facd1c9e22fb76.pdb /c /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle iterator=..\..\..\..\.install\ifc\iterator_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle regex=..\..\..\..\.install\ifc\regex_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_cbf29ce484222325.ifc /Fo..\..\..\..\.install\obj\compiler_clang_b3facd1c9e22fb76.obj ..\..\..\..\src\cairn\compilers\clang\compiler_clang.cpp
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_clang_2f01e9763865527e.pdb /c /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle concepts=..\..\..\..\.install\ifc\concepts_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle set=..\..\..\..\.install\ifc\set_0.ifc /headerUnit:angle regex=..\..\..\..\.install\ifc\regex_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle condition_variable=..\..\..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdlib=..\..\..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle limits=..\..\..\..\.install\ifc\limits_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle iterator=..\..\..\..\.install\ifc\iterator_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /Fo..\..\..\..\.install\obj\compiler_clang_2f01e9763865527e.obj ..\..\..\..\src\cairn\compilers\clang\compiler_clang.cpp
+popd
+pushd src\cairn\compilers\gcc
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_gcc_4b9f900a6746ec2b.pdb /c /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle limits=..\..\..\..\.install\ifc\limits_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle concepts=..\..\..\..\.install\ifc\concepts_0.ifc /headerUnit:angle set=..\..\..\..\.install\ifc\set_0.ifc /headerUnit:angle regex=..\..\..\..\.install\ifc\regex_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle condition_variable=..\..\..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdlib=..\..\..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle iterator=..\..\..\..\.install\ifc\iterator_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /Fo..\..\..\..\.install\obj\compiler_gcc_4b9f900a6746ec2b.obj ..\..\..\..\src\cairn\compilers\gcc\compiler_gcc.cpp
+popd
+pushd src\cairn\compilers\fake
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\..\.install\ifc /Fd..\..\..\..\.install\obj\compiler_fake_6d1f761ca92595d0.pdb /c /headerUnit:angle cstdint=..\..\..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle deque=..\..\..\..\.install\ifc\deque_0.ifc /headerUnit:angle array=..\..\..\..\.install\ifc\array_0.ifc /headerUnit:angle unordered_set=..\..\..\..\.install\ifc\unordered_set_0.ifc /headerUnit:angle utility=..\..\..\..\.install\ifc\utility_0.ifc /headerUnit:angle algorithm=..\..\..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle iostream=..\..\..\..\.install\ifc\iostream_0.ifc /headerUnit:angle optional=..\..\..\..\.install\ifc\optional_0.ifc /headerUnit:angle string_view=..\..\..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle charconv=..\..\..\..\.install\ifc\charconv_0.ifc /headerUnit:angle type_traits=..\..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle limits=..\..\..\..\.install\ifc\limits_0.ifc /headerUnit:angle system_error=..\..\..\..\.install\ifc\system_error_0.ifc /headerUnit:angle exception=..\..\..\..\.install\ifc\exception_0.ifc /headerUnit:angle cwctype=..\..\..\..\.install\ifc\cwctype_0.ifc /headerUnit:angle sstream=..\..\..\..\.install\ifc\sstream_0.ifc /headerUnit:angle variant=..\..\..\..\.install\ifc\variant_0.ifc /headerUnit:angle condition_variable=..\..\..\..\.install\ifc\condition_variable_0.ifc /headerUnit:angle cstring=..\..\..\..\.install\ifc\cstring_0.ifc /headerUnit:angle string=..\..\..\..\.install\ifc\string_0.ifc /headerUnit:angle ostream=..\..\..\..\.install\ifc\ostream_0.ifc /headerUnit:angle atomic=..\..\..\..\.install\ifc\atomic_0.ifc /headerUnit:angle fstream=..\..\..\..\.install\ifc\fstream_0.ifc /headerUnit:angle memory=..\..\..\..\.install\ifc\memory_0.ifc /headerUnit:angle queue=..\..\..\..\.install\ifc\queue_0.ifc /headerUnit:angle cstddef=..\..\..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle streambuf=..\..\..\..\.install\ifc\streambuf_0.ifc /headerUnit:angle map=..\..\..\..\.install\ifc\map_0.ifc /headerUnit:angle chrono=..\..\..\..\.install\ifc\chrono_0.ifc /headerUnit:angle tuple=..\..\..\..\.install\ifc\tuple_0.ifc /headerUnit:angle format=..\..\..\..\.install\ifc\format_0.ifc /headerUnit:angle functional=..\..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle concepts=..\..\..\..\.install\ifc\concepts_0.ifc /headerUnit:angle unordered_map=..\..\..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle iterator=..\..\..\..\.install\ifc\iterator_0.ifc /headerUnit:angle bit=..\..\..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstdlib=..\..\..\..\.install\ifc\cstdlib_0.ifc /headerUnit:angle filesystem=..\..\..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle mutex=..\..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle span=..\..\..\..\.install\ifc\span_0.ifc /headerUnit:angle set=..\..\..\..\.install\ifc\set_0.ifc /headerUnit:angle thread=..\..\..\..\.install\ifc\thread_0.ifc /headerUnit:angle vector=..\..\..\..\.install\ifc\vector_0.ifc /Fo..\..\..\..\.install\obj\compiler_fake_6d1f761ca92595d0.obj ..\..\..\..\src\cairn\compilers\fake\compiler_fake.cpp
 popd
 pushd src\cairn
-%CXX% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\main_2d411b6e0cf5dfe1.pdb /c /headerUnit:angle variant=..\..\.install\ifc\variant_cbf29ce484222325.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_cbf29ce484222325.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_cbf29ce484222325.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_cbf29ce484222325.ifc /headerUnit:angle ranges=..\..\.install\ifc\ranges_cbf29ce484222325.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_cbf29ce484222325.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_cbf29ce484222325.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_cbf29ce484222325.ifc /headerUnit:angle string=..\..\.install\ifc\string_cbf29ce484222325.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_cbf29ce484222325.ifc /headerUnit:angle numeric=..\..\.install\ifc\numeric_cbf29ce484222325.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_cbf29ce484222325.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_cbf29ce484222325.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_cbf29ce484222325.ifc /headerUnit:angle array=..\..\.install\ifc\array_cbf29ce484222325.ifc /headerUnit:angle memory=..\..\.install\ifc\memory_cbf29ce484222325.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_cbf29ce484222325.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_cbf29ce484222325.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_cbf29ce484222325.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_cbf29ce484222325.ifc /headerUnit:angle unordered_set=..\..\.install\ifc\unordered_set_cbf29ce484222325.ifc /headerUnit:angle map=..\..\.install\ifc\map_cbf29ce484222325.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_cbf29ce484222325.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_cbf29ce484222325.ifc /headerUnit:angle thread=..\..\.install\ifc\thread_cbf29ce484222325.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_cbf29ce484222325.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_cbf29ce484222325.ifc /headerUnit:angle concepts=..\..\.install\ifc\concepts_cbf29ce484222325.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_cbf29ce484222325.ifc /headerUnit:angle format=..\..\.install\ifc\format_cbf29ce484222325.ifc /headerUnit:angle span=..\..\.install\ifc\span_cbf29ce484222325.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_cbf29ce484222325.ifc /headerUnit:angle condition_variable=..\..\.install\ifc\condition_variable_cbf29ce484222325.ifc /headerUnit:angle iterator=..\..\.install\ifc\iterator_cbf29ce484222325.ifc /headerUnit:angle regex=..\..\.install\ifc\regex_cbf29ce484222325.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_cbf29ce484222325.ifc /headerUnit:angle queue=..\..\.install\ifc\queue_cbf29ce484222325.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_cbf29ce484222325.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_cbf29ce484222325.ifc /headerUnit:angle set=..\..\.install\ifc\set_cbf29ce484222325.ifc /headerUnit:angle cwctype=..\..\.install\ifc\cwctype_cbf29ce484222325.ifc /headerUnit:angle streambuf=..\..\.install\ifc\streambuf_cbf29ce484222325.ifc /Fo..\..\.install\obj\main_2d411b6e0cf5dfe1.obj ..\..\src\cairn\main.cpp
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\module_resolver_f4ce731b09f65819.pdb /c /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle functional=..\..\.install\ifc\functional_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle system_error=..\..\.install\ifc\system_error_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle cctype=..\..\.install\ifc\cctype_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle stdexcept=..\..\.install\ifc\stdexcept_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle type_traits=..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /Fo..\..\.install\obj\module_resolver_f4ce731b09f65819.obj ..\..\src\cairn\module_resolver.cpp
+popd
+pushd src\cairn
+%CLANG% /I..\..\src\cairn\utils /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\.install\ifc /Fd..\..\.install\obj\compile_commands_supp_f4ce731b09f65819.pdb /c /headerUnit:angle cstdint=..\..\.install\ifc\cstdint_0.ifc /headerUnit:angle cstddef=..\..\.install\ifc\cstddef_0.ifc /headerUnit:angle bit=..\..\.install\ifc\bit_0.ifc /headerUnit:angle unordered_map=..\..\.install\ifc\unordered_map_0.ifc /headerUnit:angle exception=..\..\.install\ifc\exception_0.ifc /headerUnit:angle string_view=..\..\.install\ifc\string_view_0.ifc /headerUnit:angle array=..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\.install\ifc\format_0.ifc /headerUnit:angle variant=..\..\.install\ifc\variant_0.ifc /headerUnit:angle sstream=..\..\.install\ifc\sstream_0.ifc /headerUnit:angle utility=..\..\.install\ifc\utility_0.ifc /headerUnit:angle chrono=..\..\.install\ifc\chrono_0.ifc /headerUnit:angle ostream=..\..\.install\ifc\ostream_0.ifc /headerUnit:angle charconv=..\..\.install\ifc\charconv_0.ifc /headerUnit:angle iostream=..\..\.install\ifc\iostream_0.ifc /headerUnit:angle string=..\..\.install\ifc\string_0.ifc /headerUnit:angle cstring=..\..\.install\ifc\cstring_0.ifc /headerUnit:angle filesystem=..\..\.install\ifc\filesystem_0.ifc /headerUnit:angle vector=..\..\.install\ifc\vector_0.ifc /headerUnit:angle optional=..\..\.install\ifc\optional_0.ifc /headerUnit:angle mutex=..\..\.install\ifc\mutex_0.ifc /headerUnit:angle algorithm=..\..\.install\ifc\algorithm_0.ifc /headerUnit:angle deque=..\..\.install\ifc\deque_0.ifc /headerUnit:angle fstream=..\..\.install\ifc\fstream_0.ifc /headerUnit:angle atomic=..\..\.install\ifc\atomic_0.ifc /headerUnit:angle span=..\..\.install\ifc\span_0.ifc /Fo..\..\.install\obj\compile_commands_supp_f4ce731b09f65819.obj ..\..\src\cairn\compile_commands_supp.cpp
+popd
+pushd src\cairn\utils
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /ifcSearchDir ..\..\..\.install\ifc /Fd..\..\..\.install\obj\log_9a8dee51f130cf79.pdb /c /headerUnit:angle array=..\..\..\.install\ifc\array_0.ifc /headerUnit:angle format=..\..\..\.install\ifc\format_0.ifc /headerUnit:angle type_traits=..\..\..\.install\ifc\type_traits_0.ifc /headerUnit:angle vector=..\..\..\.install\ifc\vector_0.ifc /headerUnit:angle functional=..\..\..\.install\ifc\functional_0.ifc /headerUnit:angle mutex=..\..\..\.install\ifc\mutex_0.ifc /headerUnit:angle iostream=..\..\..\.install\ifc\iostream_0.ifc /Fo..\..\..\.install\obj\log_9a8dee51f130cf79.obj ..\..\..\src\cairn\utils\log.cpp
 popd
 pushd .install
-%CXX% /std:c++20 /EHsc /O2 /W4 /MD /nologo /Fe..\.install\cairn.exe ..\.install\obj\factory_b3facd1c9e22fb76.obj ..\.install\obj\origin_env_2d411b6e0cf5dfe1.obj ..\.install\obj\compile_commands_supp.ifc_2d411b6e0cf5dfe1.obj ..\.install\obj\compiler_clang_b3facd1c9e22fb76.obj ..\.install\obj\abstract_compiler_2d411b6e0cf5dfe1.obj ..\.install\obj\fd_streambuf_918ff8ed1f1535e2.obj ..\.install\obj\arguments_918ff8ed1f1535e2.obj ..\.install\obj\script_build_2d411b6e0cf5dfe1.obj ..\.install\obj\builder_2d411b6e0cf5dfe1.obj ..\.install\obj\source_def_2d411b6e0cf5dfe1.obj ..\.install\obj\env_918ff8ed1f1535e2.obj ..\.install\obj\thread_pool_918ff8ed1f1535e2.obj ..\.install\obj\factory_5302eba07b1e93de.obj ..\.install\obj\utf_8_918ff8ed1f1535e2.obj ..\.install\obj\preprocess.ifc_2d411b6e0cf5dfe1.obj ..\.install\obj\cli_2d411b6e0cf5dfe1.obj ..\.install\obj\preprocess_2d411b6e0cf5dfe1.obj ..\.install\obj\compiler_gcc_5302eba07b1e93de.obj ..\.install\obj\factory_cb092f21b751850a.obj ..\.install\obj\compiler_msvc_cb092f21b751850a.obj ..\.install\obj\module_database.ifc_2d411b6e0cf5dfe1.obj ..\.install\obj\log.ifc_918ff8ed1f1535e2.obj ..\.install\obj\serialization_rules_918ff8ed1f1535e2.obj ..\.install\obj\version_2d411b6e0cf5dfe1.obj ..\.install\obj\log_918ff8ed1f1535e2.obj ..\.install\obj\module_database_2d411b6e0cf5dfe1.obj ..\.install\obj\version_918ff8ed1f1535e2.obj ..\.install\obj\scanner_2d411b6e0cf5dfe1.obj ..\.install\obj\module_type_2d411b6e0cf5dfe1.obj ..\.install\obj\compile_commands_supp_2d411b6e0cf5dfe1.obj ..\.install\obj\serializer_918ff8ed1f1535e2.obj ..\.install\obj\build_plan_2d411b6e0cf5dfe1.obj ..\.install\obj\module_resolver.ifc_2d411b6e0cf5dfe1.obj ..\.install\obj\main_2d411b6e0cf5dfe1.obj ..\.install\obj\module_resolver_2d411b6e0cf5dfe1.obj ..\.install\obj\function_view_918ff8ed1f1535e2.obj ..\.install\obj\process_918ff8ed1f1535e2.obj ..\.install\obj\gnu_compiler_setup_2d411b6e0cf5dfe1.obj ..\.install\obj\compile_target_2d411b6e0cf5dfe1.obj ..\.install\obj\hash_918ff8ed1f1535e2.obj ..\.install\obj\simple_json_918ff8ed1f1535e2.obj ..\.install\obj\process_win_918ff8ed1f1535e2.obj
+%CLANG% /std:c++20 /EHsc /O2 /W4 /MD /nologo /Fe..\.install\cairn.exe ..\.install\obj\main_f4ce731b09f65819.obj ..\.install\obj\script_build_f4ce731b09f65819.obj ..\.install\obj\module_resolver_f4ce731b09f65819.obj ..\.install\obj\module_resolver.ifc_f4ce731b09f65819.obj ..\.install\obj\compiler_msvc_d52495085800088b.obj ..\.install\obj\stats_9a8dee51f130cf79.obj ..\.install\obj\compile_target_f4ce731b09f65819.obj ..\.install\obj\cli_f4ce731b09f65819.obj ..\.install\obj\arguments_9a8dee51f130cf79.obj ..\.install\obj\factory_6d1f761ca92595d0.obj ..\.install\obj\trace_9a8dee51f130cf79.obj ..\.install\obj\artifact_cache_f4ce731b09f65819.obj ..\.install\obj\load_monitor_9a8dee51f130cf79.obj ..\.install\obj\serialization_rules_9a8dee51f130cf79.obj ..\.install\obj\compiler_fake_6d1f761ca92595d0.obj ..\.install\obj\abstract_compiler_f4ce731b09f65819.obj ..\.install\obj\source_def_f4ce731b09f65819.obj ..\.install\obj\compiler_clang_2f01e9763865527e.obj ..\.install\obj\scanner_f4ce731b09f65819.obj ..\.install\obj\module_database_f4ce731b09f65819.obj ..\.install\obj\thread_pool_9a8dee51f130cf79.obj ..\.install\obj\function_view_9a8dee51f130cf79.obj ..\.install\obj\log.ifc_9a8dee51f130cf79.obj ..\.install\obj\env_9a8dee51f130cf79.obj ..\.install\obj\builder_f4ce731b09f65819.obj ..\.install\obj\worker_f4ce731b09f65819.obj ..\.install\obj\build_plan_f4ce731b09f65819.obj ..\.install\obj\remote_protocol_f4ce731b09f65819.obj ..\.install\obj\module_type_f4ce731b09f65819.obj ..\.install\obj\file_watcher_9a8dee51f130cf79.obj ..\.install\obj\compile_commands_supp.ifc_f4ce731b09f65819.obj ..\.install\obj\module_database.ifc_f4ce731b09f65819.obj ..\.install\obj\hash_9a8dee51f130cf79.obj ..\.install\obj\compile_commands_supp_f4ce731b09f65819.obj ..\.install\obj\log_9a8dee51f130cf79.obj ..\.install\obj\process_9a8dee51f130cf79.obj ..\.install\obj\factory_d52495085800088b.obj ..\.install\obj\version_f4ce731b09f65819.obj ..\.install\obj\jobserver_9a8dee51f130cf79.obj ..\.install\obj\preprocess_f4ce731b09f65819.obj ..\.install\obj\serializer_9a8dee51f130cf79.obj ..\.install\obj\preprocess.ifc_f4ce731b09f65819.obj ..\.install\obj\compiler_gcc_4b9f900a6746ec2b.obj ..\.install\obj\version_9a8dee51f130cf79.obj ..\.install\obj\origin_env_f4ce731b09f65819.obj ..\.install\obj\remote_executor_f4ce731b09f65819.obj ..\.install\obj\gnu_compiler_setup_f4ce731b09f65819.obj ..\.install\obj\factory_4b9f900a6746ec2b.obj ..\.install\obj\simple_json_9a8dee51f130cf79.obj ..\.install\obj\utf_8_9a8dee51f130cf79.obj ..\.install\obj\factory_2f01e9763865527e.obj ..\.install\obj\fd_streambuf_9a8dee51f130cf79.obj ..\.install\obj\p1689_scanner_f4ce731b09f65819.obj ..\.install\obj\process_win_9a8dee51f130cf79.obj
 popd
 exit /b 0
 
@@ -1,302 +1,367 @@
-.PHONY: all t_0 t_1 t_2 t_3 t_4 t_5 t_6 t_7 t_8 t_9 t_10 t_11 t_12 t_13 t_14 t_15 t_16 t_17 t_18 t_19 t_20 t_21 t_22 t_23 t_24 t_25 t_26 t_27 t_28 t_29 t_30 t_31 t_32 t_33 t_34 t_35 t_36 t_37 t_38 t_39 t_40 t_41 t_42 t_43 t_44 t_45 t_46 t_47 t_48 t_49 t_50 t_51 t_52 t_53 t_54 t_55 t_56 t_57 t_58 t_59 t_60 t_61 t_62 t_63 t_64 t_65 t_66 t_67 t_68 t_69 t_70 t_71 t_72 t_73 t_74 t_75 t_76 t_77 t_78 t_79 t_80 t_81 t_82 t_83 t_84 t_85 t_86
-all: t_42
+.PHONY: all t_0 t_1 t_2 t_3 t_4 t_5 t_6 t_7 t_8 t_9 t_10 t_11 t_12 t_13 t_14 t_15 t_16 t_17 t_18 t_19 t_20 t_21 t_22 t_23 t_24 t_25 t_26 t_27 t_28 t_29 t_30 t_31 t_32 t_33 t_34 t_35 t_36 t_37 t_38 t_39 t_40 t_41 t_42 t_43 t_44 t_45 t_46 t_47 t_48 t_49 t_50 t_51 t_52 t_53 t_54 t_55 t_56 t_57 t_58 t_59 t_60 t_61 t_62 t_63 t_64 t_65 t_66 t_67 t_68 t_69 t_70 t_71 t_72 t_73 t_74 t_75 t_76 t_77 t_78 t_79 t_80 t_81 t_82 t_83 t_84 t_85 t_86 t_87 t_88 t_89 t_90 t_91 t_92 t_93 t_94 t_95 t_96 t_97 t_98 t_99 t_100 t_101 t_102 t_103 t_104
+all: t_54
 
 CLANG ?= clang++
 
-t_0: t_43 t_44 t_45 t_32 t_18 t_19 t_10 t_46 t_47 t_48 t_49 t_50 t_51 t_52 t_53 t_54 t_55| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/process_posix.cpp -o ../../../.install/pcm/cairn.utils.process-posix.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/process_posix.cpp -o ../../../.install/obj/process_posix_9a8dee51f130cf79.o
+t_0: t_55 t_56 t_57 t_58 t_59 t_60 t_61 t_62 t_63 t_24 t_52 t_64 t_11 t_23 t_65 t_37 t_66 t_67 t_68 t_69 t_70 t_71 t_72 t_73 t_74| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/process_posix.cpp -o ../../../.install/pcm/cairn.utils.process-posix.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/process_posix.cpp -o ../../../.install/obj/process_posix_9a8dee51f130cf79.o
 
-t_1: t_56 t_49 t_54 t_57 t_58 t_46 t_59 t_60 t_61 t_4| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/charconv_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/simple_json.cpp -o ../../../.install/pcm/cairn.utils.simple_json.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/charconv_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/simple_json.cpp -o ../../../.install/obj/simple_json_9a8dee51f130cf79.o
+t_1: t_75 t_76 t_77 t_63 t_67 t_78 t_62 t_79 t_80| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/concepts_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/serializer.cpp -o ../../../.install/pcm/cairn.utils.serializer.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/concepts_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/serializer.cpp -o ../../../.install/obj/serializer_9a8dee51f130cf79.o
 
-t_2: t_48 t_46 t_39 t_22| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/module_resolver.ifc.cpp -o ../../.install/pcm/cairn.module_resolver.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_resolver.ifc.cpp -o ../../.install/obj/module_resolver.ifc_f4ce731b09f65819.o
+t_2: t_61 t_0 t_68 t_69 t_65 t_73 t_67 t_40 t_10 t_24 t_7 t_57 t_58 t_14 t_46 t_81 t_23 t_82 t_37 t_33 t_1 t_79| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdlib_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/gnu_compiler_setup.cpp -o ../../.install/pcm/cairn.gnu_compiler_setup.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdlib_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/gnu_compiler_setup.cpp -o ../../.install/obj/gnu_compiler_setup_f4ce731b09f65819.o
 
-t_3: t_62| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/version.cpp -o ../../.install/pcm/cairn.version.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/version.cpp -o ../../.install/obj/version_f4ce731b09f65819.o
+t_3: t_66 t_81 t_75 t_83 t_84 t_85 t_86 t_37 t_40| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/deque_0.~hdr.pcm -fmodule-file=../../.install/pcm/charconv_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/preprocess.cpp -o ../../.install/obj/preprocess_f4ce731b09f65819.o
 
-t_4: t_57 t_54 t_43| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/utf_8.cpp -o ../../../.install/pcm/cairn.utils.utf8.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/utf_8.cpp -o ../../../.install/obj/utf_8_9a8dee51f130cf79.o
+t_4: t_65 t_73 t_87| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/sstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/version.cpp -o ../../../.install/pcm/cairn.utils.version.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/sstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/version.cpp -o ../../../.install/obj/version_9a8dee51f130cf79.o
 
-t_5: t_63 t_54 t_48| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/serialization_rules.cpp -o ../../../.install/pcm/cairn.utils.serializer.rules.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/serialization_rules.cpp -o ../../../.install/obj/serialization_rules_9a8dee51f130cf79.o
+t_5: t_69| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/compile_target.cpp -o ../../.install/pcm/cairn.compile_target.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_target.cpp -o ../../.install/obj/compile_target_f4ce731b09f65819.o
 
-t_6: t_44 t_33| workdir 
-	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/gcc/factory.cpp -o ../../../../.install/pcm/cairn.compiler.gcc.pcm
-	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/gcc/factory.cpp -o ../../../../.install/obj/factory_4b9f900a6746ec2b.o
+t_6: t_88| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/version.cpp -o ../../.install/pcm/cairn.version.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/version.cpp -o ../../.install/obj/version_f4ce731b09f65819.o
 
-t_7: t_64 t_65 t_66 t_67 t_63 t_44| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/thread_pool.cpp -o ../../../.install/pcm/cairn.utils.threadpool.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/thread_pool.cpp -o ../../../.install/obj/thread_pool_9a8dee51f130cf79.o
+t_7: t_0| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/process.cpp -o ../../../.install/pcm/cairn.utils.process.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/process.cpp -o ../../../.install/obj/process_9a8dee51f130cf79.o
 
-t_8: t_49 t_59 t_9 t_32 t_29 t_48 t_54 t_56 t_4 t_1 t_68 t_69 t_70 t_58 t_62 t_46| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/sstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_commands_supp.cpp -o ../../.install/obj/compile_commands_supp_f4ce731b09f65819.o
+t_8: t_69 t_13| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/source_def.cpp -o ../../.install/pcm/cairn.source_def.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/source_def.cpp -o ../../.install/obj/source_def_f4ce731b09f65819.o
 
-t_9: t_1 t_32 t_59 t_58 t_46 t_29 t_48| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/compile_commands_supp.ifc.cpp -o ../../.install/pcm/cairn.compile_commands.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_commands_supp.ifc.cpp -o ../../.install/obj/compile_commands_supp.ifc_f4ce731b09f65819.o
+t_9: t_59 t_68 t_81 t_56 t_86 t_65 t_23| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/load_monitor.cpp -o ../../../.install/pcm/cairn.utils.load_monitor.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/load_monitor.cpp -o ../../../.install/obj/load_monitor_9a8dee51f130cf79.o
 
-t_10: t_63 t_71 t_72 t_46 t_61| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/log.ifc.cpp -o ../../../.install/pcm/cairn.utils.log.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/log.ifc.cpp -o ../../../.install/obj/log.ifc_9a8dee51f130cf79.o
+t_10: t_76 t_89 t_66 t_90 t_59 t_63| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/thread_pool.cpp -o ../../../.install/pcm/cairn.utils.threadpool.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/thread_pool.cpp -o ../../../.install/obj/thread_pool_9a8dee51f130cf79.o
+
+t_11: t_78 t_65 t_91 t_73 t_71| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cwctype_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/env.cpp -o ../../../.install/pcm/cairn.utils.env.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cwctype_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/env.cpp -o ../../../.install/obj/env_9a8dee51f130cf79.o
 
-t_11: t_65 t_46 t_54 t_45| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/build_plan.cpp -o ../../.install/pcm/cairn.build_plan.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/build_plan.cpp -o ../../.install/obj/build_plan_f4ce731b09f65819.o
+t_12: t_73 t_69| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/origin_env.cpp -o ../../.install/pcm/cairn.origin_env.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/origin_env.cpp -o ../../.install/obj/origin_env_f4ce731b09f65819.o
 
-t_12: t_62| workdir 
+t_13: t_88| workdir 
 	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/module_type.cpp -o ../../.install/pcm/cairn.module_type.pcm
 	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_type.cpp -o ../../.install/obj/module_type_f4ce731b09f65819.o
 
-t_13: t_0 t_61 t_58 t_49 t_55 t_68 t_73 t_48 t_28 t_57 t_23 t_7 t_9 t_44 t_74 t_35 t_4 t_12 t_71 t_27 t_33 t_45 t_18 t_32 t_36 t_10 t_22 t_38 t_16| workdir 
-	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/regex_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/clang/compiler_clang.cpp -o ../../../../.install/obj/compiler_clang_2f01e9763865527e.o
+t_14: t_75 t_92 t_69 t_73 t_65 t_86 t_13| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/tuple_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/scanner.cpp -o ../../.install/pcm/cairn.source_scanner.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/tuple_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/scanner.cpp -o ../../.install/obj/scanner_f4ce731b09f65819.o
 
-t_14: t_4 t_10 t_2 t_49 t_62 t_48 t_29 t_75 t_68 t_54 t_55 t_51 t_46 t_61 t_72| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/cctype_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_resolver.cpp -o ../../.install/obj/module_resolver_f4ce731b09f65819.o
+t_15: t_93 t_88 t_66 t_81 t_73 t_69 t_86 t_58 t_37 t_65 t_23 t_56 t_20| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/trace.cpp -o ../../../.install/pcm/cairn.utils.trace.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/trace.cpp -o ../../../.install/obj/trace_9a8dee51f130cf79.o
 
-t_15: t_58 t_48 t_73 t_12 t_46 t_76 t_16 t_63 t_2 t_45 t_32 t_59 t_72 t_29 t_22 t_77 t_33 t_39 t_11 t_9 t_78| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/module_database.ifc.cpp -o ../../.install/pcm/cairn.module_database.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_database.ifc.cpp -o ../../.install/obj/module_database.ifc_f4ce731b09f65819.o
+t_16: t_61 t_94 t_78 t_76 t_56 t_13 t_95 t_29 t_24 t_73 t_31 t_12 t_45 t_60 t_5 t_47 t_38 t_69 t_17 t_32 t_57 t_14 t_58| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/module_database.ifc.cpp -o ../../.install/pcm/cairn.module_database.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_database.ifc.cpp -o ../../.install/obj/module_database.ifc_f4ce731b09f65819.o
 
-t_16: t_46 t_48 t_54 t_57 t_12| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/scanner.cpp -o ../../.install/pcm/cairn.source_scanner.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/scanner.cpp -o ../../.install/obj/scanner_f4ce731b09f65819.o
+t_17: t_56 t_86 t_60 t_61 t_0 t_69 t_93 t_41 t_13 t_8 t_73 t_31 t_12 t_11 t_14 t_63 t_24 t_29 t_88 t_7 t_23 t_37| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/abstract_compiler.cpp -o ../../.install/pcm/cairn.abstract_compiler.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/abstract_compiler.cpp -o ../../.install/obj/abstract_compiler_f4ce731b09f65819.o
 
-t_17: t_46 t_62 t_54 t_48 t_58 t_68 t_4 t_32 t_45 t_77 t_11 t_79 t_15| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/set_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/script_build.cpp -o ../../.install/pcm/cairn.script_build.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/set_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/script_build.cpp -o ../../.install/obj/script_build_f4ce731b09f65819.o
+t_18: t_73 t_65 t_61 t_83 t_13 t_93 t_95 t_24 t_88 t_7 t_20 t_23 t_37 t_86 t_14 t_46 t_81 t_58 t_0 t_68 t_69| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/p1689_scanner.cpp -o ../../.install/pcm/cairn.p1689_scanner.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/p1689_scanner.cpp -o ../../.install/obj/p1689_scanner_f4ce731b09f65819.o
 
-t_18: t_46 t_77 t_54 t_80 t_51| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cwctype_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/env.cpp -o ../../../.install/pcm/cairn.utils.env.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cwctype_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/env.cpp -o ../../../.install/obj/env_9a8dee51f130cf79.o
+t_19: t_73 t_75 t_71 t_88 t_65 t_52 t_60 t_33 t_37 t_61 t_1 t_79 t_62 t_24 t_63 t_67 t_66 t_69 t_68| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/remote_protocol.cpp -o ../../.install/pcm/cairn.remote.protocol.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/remote_protocol.cpp -o ../../.install/obj/remote_protocol_f4ce731b09f65819.o
 
-t_19: t_46 t_81| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/streambuf_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/fd_streambuf.cpp -o ../../../.install/pcm/cairn.utils.fd_streambuf.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/streambuf_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/fd_streambuf.cpp -o ../../../.install/obj/fd_streambuf_9a8dee51f130cf79.o
+t_20: t_96 t_93 t_65 t_86 t_57 t_73 t_85 t_94 t_68 t_46| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/charconv_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/simple_json.cpp -o ../../../.install/pcm/cairn.utils.simple_json.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/charconv_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/simple_json.cpp -o ../../../.install/obj/simple_json_9a8dee51f130cf79.o
 
-t_20: t_63 t_79 t_44 t_55 t_77 t_43 t_82 t_83 t_84| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/concepts_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/serializer.cpp -o ../../../.install/pcm/cairn.utils.serializer.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/concepts_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/serializer.cpp -o ../../../.install/obj/serializer_9a8dee51f130cf79.o
+t_21: t_0 t_11 t_30 t_17 t_69 t_8 t_29 t_18 t_95 t_63 t_13 t_23 t_14 t_46 t_81 t_57 t_7 t_24 t_97 t_37 t_68 t_40 t_2 t_86 t_67 t_98 t_93 t_12 t_4 t_61| workdir 
+	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/regex_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/clang/compiler_clang.cpp -o ../../../../.install/obj/compiler_clang_2f01e9763865527e.o
 
-t_21: t_65 t_61 t_85 t_69 t_12 t_33 t_76 t_2 t_16 t_38 t_32 t_20 t_29 t_10 t_15 t_9 t_86 t_5| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/ranges_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_database.cpp -o ../../.install/obj/module_database_f4ce731b09f65819.o
+t_22: t_55 t_59 t_73 t_71 t_69 t_79 t_56 t_57 t_61 t_86 t_37 t_65 t_23| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/file_watcher.cpp -o ../../../.install/pcm/cairn.utils.file_watcher.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/file_watcher.cpp -o ../../../.install/obj/file_watcher_9a8dee51f130cf79.o
 
-t_22: t_46 t_48| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/origin_env.cpp -o ../../.install/pcm/cairn.origin_env.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/origin_env.cpp -o ../../.install/obj/origin_env_f4ce731b09f65819.o
+t_23: t_76 t_98 t_60 t_73 t_93| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/log.ifc.cpp -o ../../../.install/pcm/cairn.utils.log.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/log.ifc.cpp -o ../../../.install/obj/log.ifc_9a8dee51f130cf79.o
 
-t_23: t_71 t_57 t_85 t_58 t_49 t_46 t_54 t_48 t_45| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/preprocess.ifc.cpp -o ../../.install/pcm/cairn.preprocess.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/preprocess.ifc.cpp -o ../../.install/obj/preprocess.ifc_f4ce731b09f65819.o
+t_24: t_86 t_61 t_62 t_69 t_94 t_88 t_65| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/arguments.cpp -o ../../../.install/pcm/cairn.utils.arguments.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/arguments.cpp -o ../../../.install/obj/arguments_9a8dee51f130cf79.o
 
-t_24: t_72 t_66 t_43 t_46 t_10| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/log.cpp -o ../../../.install/obj/log_9a8dee51f130cf79.o
+t_25: t_88 t_67 t_68 t_63 t_93 t_71 t_69 t_72 t_65 t_82 t_23| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdlib_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/jobserver.cpp -o ../../../.install/pcm/cairn.utils.jobserver.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cerrno_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdlib_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/jobserver.cpp -o ../../../.install/obj/jobserver_9a8dee51f130cf79.o
 
-t_25: t_0 t_76 t_61 t_85 t_55 t_68 t_48 t_28 t_23 t_6 t_16 t_9 t_74 t_44 t_35 t_56 t_4 t_43 t_36 t_45 t_18 t_32 t_71 t_33 t_12 t_7 t_38 t_10 t_22| workdir 
-	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/regex_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/array_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/gcc/compiler_gcc.cpp -o ../../../../.install/obj/compiler_gcc_4b9f900a6746ec2b.o
+t_26: t_94 t_20 t_29 t_24 t_73 t_31 t_87 t_46 t_81 t_57 t_68 t_69 t_37 t_99 t_96 t_65 t_88| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/sstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_commands_supp.cpp -o ../../.install/obj/compile_commands_supp_f4ce731b09f65819.o
 
-t_26: t_44 t_33| workdir 
-	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/msvc/factory.cpp -o ../../../../.install/pcm/cairn.compiler.msvc.pcm
-	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/msvc/factory.cpp -o ../../../../.install/obj/factory_d52495085800088b.o
+t_27: t_73 t_69 t_19 t_5 t_83 t_6 t_65 t_23 t_24| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/cli.cpp -o ../../.install/pcm/cairn.cli.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/cli.cpp -o ../../.install/obj/cli_f4ce731b09f65819.o
 
-t_27: t_44 t_33| workdir 
+t_28: t_88 t_65 t_73 t_69 t_61 t_57 t_78 t_77 t_24 t_81 t_46 t_45 t_16| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/script_build.cpp -o ../../.install/pcm/cairn.script_build.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/set_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/script_build.cpp -o ../../.install/obj/script_build_f4ce731b09f65819.o
+
+t_29: t_20 t_31 t_24 t_94 t_57 t_73 t_69| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/compile_commands_supp.ifc.cpp -o ../../.install/pcm/cairn.compile_commands.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_commands_supp.ifc.cpp -o ../../.install/obj/compile_commands_supp.ifc_f4ce731b09f65819.o
+
+t_30: t_63 t_17| workdir 
 	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/clang/factory.cpp -o ../../../../.install/pcm/cairn.compiler.clang.pcm
 	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/clang/factory.cpp -o ../../../../.install/obj/factory_2f01e9763865527e.o
 
-t_28: t_58 t_49 t_0 t_45 t_76 t_46 t_4 t_48 t_54 t_36 t_32 t_7 t_23| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/gnu_compiler_setup.cpp -o ../../.install/pcm/cairn.gnu_compiler_setup.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/gnu_compiler_setup.cpp -o ../../.install/obj/gnu_compiler_setup_f4ce731b09f65819.o
+t_31: t_75 t_88 t_65 t_81 t_69 t_74 t_70 t_79 t_100 t_98| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/bit_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/hash.cpp -o ../../../.install/pcm/cairn.utils.hash.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstring_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/bit_0.~hdr.pcm -fmodule-file=../../../.install/pcm/array_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/hash.cpp -o ../../../.install/obj/hash_9a8dee51f130cf79.o
 
-t_29: t_82 t_47| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/hash.cpp -o ../../../.install/pcm/cairn.utils.hash.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstddef_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/hash.cpp -o ../../../.install/obj/hash_9a8dee51f130cf79.o
+t_32: t_55 t_59 t_88 t_65 t_61 t_66 t_63 t_95 t_19 t_73 t_31 t_23 t_37 t_98 t_56 t_86 t_60 t_79 t_68 t_17 t_69 t_62 t_57 t_81| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/remote_executor.cpp -o ../../.install/pcm/cairn.remote.executor.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/remote_executor.cpp -o ../../.install/obj/remote_executor_f4ce731b09f65819.o
+
+t_33: t_76 t_65 t_69| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/serialization_rules.cpp -o ../../../.install/pcm/cairn.utils.serializer.rules.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/serialization_rules.cpp -o ../../../.install/obj/serialization_rules_9a8dee51f130cf79.o
 
-t_30: t_0 t_58 t_46 t_61 t_48 t_54 t_68 t_45 t_32 t_18 t_50 t_26 t_43 t_36 t_77 t_33 t_12 t_23 t_4 t_20 t_5 t_9 t_10 t_22 t_38 t_16| workdir 
-	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/map_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/msvc/compiler_msvc.cpp -o ../../../../.install/obj/compiler_msvc_d52495085800088b.o
+t_34: t_73 t_75 t_0 t_68 t_17 t_63 t_45 t_7 t_10 t_25 t_9 t_23 t_66 t_89 t_56 t_60 t_86| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/builder.cpp -o ../../.install/pcm/cairn.builder.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/builder.cpp -o ../../.install/obj/builder_f4ce731b09f65819.o
 
-t_31: t_48 t_39 t_3 t_46 t_10 t_32| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/cli.cpp -o ../../.install/pcm/cairn.cli.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/cli.cpp -o ../../.install/obj/cli_f4ce731b09f65819.o
+t_35: t_61 t_73 t_64 t_86 t_65 t_62 t_11 t_93 t_42 t_33 t_0 t_69 t_17 t_78 t_40 t_24 t_29 t_23 t_57 t_81 t_14 t_46 t_7 t_12 t_8 t_1 t_13| workdir 
+	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/numeric_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/msvc/compiler_msvc.cpp -o ../../../../.install/obj/compiler_msvc_d52495085800088b.o
 
-t_32: t_43 t_57 t_45 t_59 t_62 t_48 t_54| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/arguments.cpp -o ../../../.install/pcm/cairn.utils.arguments.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../.install/pcm/variant_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/arguments.cpp -o ../../../.install/obj/arguments_9a8dee51f130cf79.o
+t_36: t_73 t_59 t_65 t_61 t_93 t_90 t_66 t_60 t_82 t_81 t_14 t_40 t_56 t_23 t_63 t_95 t_29 t_24 t_8 t_69 t_17 t_12 t_43 t_2 t_13 t_89| workdir 
+	cd src/cairn/compilers/fake; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/cstdlib_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/condition_variable_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/fake/compiler_fake.cpp -o ../../../../.install/obj/compiler_fake_6d1f761ca92595d0.o
 
-t_33: t_0 t_46 t_12 t_38 t_16 t_37 t_36 t_48 t_22 t_10 t_45 t_32 t_18 t_9 t_62 t_61| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/abstract_compiler.cpp -o ../../.install/pcm/cairn.abstract_compiler.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/abstract_compiler.cpp -o ../../.install/obj/abstract_compiler_f4ce731b09f65819.o
+t_37: t_88 t_20 t_56 t_86 t_79 t_84 t_69 t_62 t_93 t_58 t_81 t_66 t_99 t_65| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/deque_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/stats.cpp -o ../../../.install/pcm/cairn.utils.stats.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../../.install/pcm/deque_0.~hdr.pcm -fmodule-file=../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/stats.cpp -o ../../../.install/obj/stats_9a8dee51f130cf79.o
 
-t_34: t_44 t_66 t_10 t_7 t_11 t_76 t_33| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/builder.cpp -o ../../.install/pcm/cairn.builder.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/builder.cpp -o ../../.install/obj/builder_f4ce731b09f65819.o
+t_38: t_57 t_59 t_88 t_24 t_73 t_31 t_23 t_82 t_65 t_37 t_61 t_79 t_17 t_69 t_93 t_60 t_66| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdlib_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/artifact_cache.cpp -o ../../.install/pcm/cairn.artifact_cache.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdlib_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -fmodule-file=../../.install/pcm/cstdint_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/artifact_cache.cpp -o ../../.install/obj/artifact_cache_f4ce731b09f65819.o
 
-t_35: t_54 t_46 t_70| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/sstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/version.cpp -o ../../../.install/pcm/cairn.utils.version.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/sstream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/version.cpp -o ../../../.install/obj/version_9a8dee51f130cf79.o
+t_39: t_13 t_17 t_69 t_8 t_18 t_29 t_63 t_7 t_24 t_97 t_46 t_14 t_81 t_0 t_58 t_37 t_50 t_23 t_40 t_2 t_11 t_62 t_98 t_93 t_67 t_96 t_55 t_12 t_4 t_61| workdir 
+	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/regex_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/gcc/compiler_gcc.cpp -o ../../../../.install/obj/compiler_gcc_4b9f900a6746ec2b.o
 
-t_36: t_0| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/process.cpp -o ../../../.install/pcm/cairn.utils.process.pcm
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/process.cpp -o ../../../.install/obj/process_9a8dee51f130cf79.o
+t_40: t_63 t_98 t_88 t_55 t_68 t_65 t_73 t_69 t_86 t_57 t_61 t_41| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/preprocess.ifc.cpp -o ../../.install/pcm/cairn.preprocess.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/preprocess.ifc.cpp -o ../../.install/obj/preprocess.ifc_f4ce731b09f65819.o
 
-t_37: t_82 t_63| workdir 
+t_41: t_75 t_76| workdir 
 	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/function_view.cpp -o ../../../.install/pcm/cairn.utils.function_view.pcm
 	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/type_traits_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/function_view.cpp -o ../../../.install/obj/function_view_9a8dee51f130cf79.o
 
-t_38: t_48 t_12| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/source_def.cpp -o ../../.install/pcm/cairn.source_def.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/source_def.cpp -o ../../.install/obj/source_def_f4ce731b09f65819.o
-
-t_39: t_48| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/compile_target.cpp -o ../../.install/pcm/cairn.compile_target.pcm
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/compile_target.cpp -o ../../.install/obj/compile_target_f4ce731b09f65819.o
-
-t_40: t_68 t_65 t_82 t_23| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/preprocess.cpp -o ../../.install/obj/preprocess_f4ce731b09f65819.o
-
-t_41: t_61 t_43 t_7 t_31 t_15 t_10 t_9 t_26 t_16 t_32 t_27 t_71 t_77 t_67 t_22 t_34 t_12 t_6 t_33 t_11 t_68 t_4 t_17 t_2 t_46 t_48 t_44 t_51 t_56 t_85 t_58 t_57| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/main.cpp -o ../../.install/obj/main_f4ce731b09f65819.o
-
-t_42: t_0 t_1 t_2 t_3 t_4 t_5 t_6 t_7 t_8 t_9 t_10 t_11 t_12 t_13 t_14 t_15 t_16 t_17 t_18 t_19 t_20 t_21 t_22 t_23 t_24 t_25 t_26 t_27 t_28 t_29 t_30 t_31 t_32 t_33 t_34 t_35 t_36 t_37 t_38 t_39 t_40 t_41| workdir 
-	cd .install; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG ../.install/obj/main_f4ce731b09f65819.o ../.install/obj/preprocess_f4ce731b09f65819.o ../.install/obj/compile_target_f4ce731b09f65819.o ../.install/obj/function_view_9a8dee51f130cf79.o ../.install/obj/process_9a8dee51f130cf79.o ../.install/obj/arguments_9a8dee51f130cf79.o ../.install/obj/cli_f4ce731b09f65819.o ../.install/obj/compiler_msvc_d52495085800088b.o ../.install/obj/gnu_compiler_setup_f4ce731b09f65819.o ../.install/obj/compiler_gcc_4b9f900a6746ec2b.o ../.install/obj/preprocess.ifc_f4ce731b09f65819.o ../.install/obj/serializer_9a8dee51f130cf79.o ../.install/obj/module_database_f4ce731b09f65819.o ../.install/obj/fd_streambuf_9a8dee51f130cf79.o ../.install/obj/abstract_compiler_f4ce731b09f65819.o ../.install/obj/env_9a8dee51f130cf79.o ../.install/obj/factory_2f01e9763865527e.o ../.install/obj/script_build_f4ce731b09f65819.o ../.install/obj/source_def_f4ce731b09f65819.o ../.install/obj/scanner_f4ce731b09f65819.o ../.install/obj/module_resolver_f4ce731b09f65819.o ../.install/obj/log_9a8dee51f130cf79.o ../.install/obj/compiler_clang_2f01e9763865527e.o ../.install/obj/module_type_f4ce731b09f65819.o ../.install/obj/build_plan_f4ce731b09f65819.o ../.install/obj/version_9a8dee51f130cf79.o ../.install/obj/log.ifc_9a8dee51f130cf79.o ../.install/obj/compile_commands_supp_f4ce731b09f65819.o ../.install/obj/factory_d52495085800088b.o ../.install/obj/module_database.ifc_f4ce731b09f65819.o ../.install/obj/thread_pool_9a8dee51f130cf79.o ../.install/obj/factory_4b9f900a6746ec2b.o ../.install/obj/builder_f4ce731b09f65819.o ../.install/obj/serialization_rules_9a8dee51f130cf79.o ../.install/obj/origin_env_f4ce731b09f65819.o ../.install/obj/utf_8_9a8dee51f130cf79.o ../.install/obj/hash_9a8dee51f130cf79.o ../.install/obj/version_f4ce731b09f65819.o ../.install/obj/compile_commands_supp.ifc_f4ce731b09f65819.o ../.install/obj/module_resolver.ifc_f4ce731b09f65819.o ../.install/obj/simple_json_9a8dee51f130cf79.o ../.install/obj/process_posix_9a8dee51f130cf79.o -o ../.install/cairn
+t_42: t_63 t_17| workdir 
+	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/msvc/factory.cpp -o ../../../../.install/pcm/cairn.compiler.msvc.pcm
+	cd src/cairn/compilers/msvc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/msvc/factory.cpp -o ../../../../.install/obj/factory_d52495085800088b.o
 
-t_43:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile iostream -o ../../.install/pcm/iostream_0.~hdr.pcm
+t_43: t_63 t_17| workdir 
+	cd src/cairn/compilers/fake; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/fake/factory.cpp -o ../../../../.install/pcm/cairn.compiler.fake.pcm
+	cd src/cairn/compilers/fake; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/fake/factory.cpp -o ../../../../.install/obj/factory_6d1f761ca92595d0.o
 
-t_44:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile memory -o ../../.install/pcm/memory_0.~hdr.pcm
+t_44: t_37 t_23 t_47 t_101 t_71 t_46 t_81 t_69 t_68 t_67 t_65 t_88 t_93 t_60 t_73 t_31| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/cctype_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_resolver.cpp -o ../../.install/obj/module_resolver_f4ce731b09f65819.o
 
-t_45:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile span -o ../../.install/pcm/span_0.~hdr.pcm
+t_45: t_90 t_73 t_65 t_86 t_61| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/build_plan.cpp -o ../../.install/pcm/cairn.build_plan.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/span_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/build_plan.cpp -o ../../.install/obj/build_plan_f4ce731b09f65819.o
 
-t_46:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile vector -o ../../.install/pcm/vector_0.~hdr.pcm
+t_46: t_86 t_65 t_62| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/utf_8.cpp -o ../../../.install/pcm/cairn.utils.utf8.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/utf_8.cpp -o ../../../.install/obj/utf_8_9a8dee51f130cf79.o
 
-t_47:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstddef -o ../../../.install/pcm/cstddef_0.~hdr.pcm
+t_47: t_69 t_73 t_5 t_12| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/module_resolver.ifc.cpp -o ../../.install/pcm/cairn.module_resolver.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_resolver.ifc.cpp -o ../../.install/obj/module_resolver.ifc_f4ce731b09f65819.o
 
-t_48:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile filesystem -o ../../.install/pcm/filesystem_0.~hdr.pcm
+t_48: t_60 t_66 t_73 t_62 t_23| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/iostream_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/log.cpp -o ../../../.install/obj/log_9a8dee51f130cf79.o
 
-t_49:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile optional -o ../../.install/pcm/optional_0.~hdr.pcm
+t_49: t_59 t_65 t_102 t_67 t_66 t_73 t_31 t_23 t_88 t_7 t_75 t_57 t_81 t_10 t_93 t_86 t_56 t_0 t_69 t_19 t_24 t_95 t_63| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/random_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -xc++-module --precompile ../../src/cairn/worker.cpp -o ../../.install/pcm/cairn.worker.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/random_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_view_0.~hdr.pcm -fmodule-file=../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/worker.cpp -o ../../.install/obj/worker_f4ce731b09f65819.o
 
-t_50:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile numeric -o ../../../.install/pcm/numeric_0.~hdr.pcm
+t_50: t_63 t_17| workdir 
+	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -xc++-module --precompile ../../../../src/cairn/compilers/gcc/factory.cpp -o ../../../../.install/pcm/cairn.compiler.gcc.pcm
+	cd src/cairn/compilers/gcc; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../../.install/pcm/memory_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../../.install/pcm -c ../../../../src/cairn/compilers/gcc/factory.cpp -o ../../../../.install/obj/factory_4b9f900a6746ec2b.o
 
-t_51:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile system_error -o ../../.install/pcm/system_error_0.~hdr.pcm
+t_51: t_83 t_103 t_55 t_93 t_90 t_60 t_96 t_10 t_99 t_37 t_66 t_15 t_47 t_33 t_58 t_14 t_89 t_13 t_1 t_8 t_29 t_24 t_31 t_20 t_23 t_68 t_16 t_17| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/limits_0.~hdr.pcm -fmodule-file=../../.install/pcm/ranges_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/queue_0.~hdr.pcm -fmodule-file=../../.install/pcm/functional_0.~hdr.pcm -fmodule-file=../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../.install/pcm/ostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/mutex_0.~hdr.pcm -fmodule-file=../../.install/pcm/atomic_0.~hdr.pcm -fmodule-file=../../.install/pcm/condition_variable_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/module_database.cpp -o ../../.install/obj/module_database_f4ce731b09f65819.o
 
-t_52:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstring -o ../../../.install/pcm/cstring_0.~hdr.pcm
+t_52: t_75 t_73 t_104| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/streambuf_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -xc++-module --precompile ../../../src/cairn/utils/fd_streambuf.cpp -o ../../../.install/pcm/cairn.utils.fd_streambuf.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../../.install/pcm/utility_0.~hdr.pcm -fmodule-file=../../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../../.install/pcm/streambuf_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../../.install/pcm -c ../../../src/cairn/utils/fd_streambuf.cpp -o ../../../.install/obj/fd_streambuf_9a8dee51f130cf79.o
 
-t_53:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cerrno -o ../../../.install/pcm/cerrno_0.~hdr.pcm
+t_53: t_95 t_93 t_59 t_78 t_57 t_55 t_71 t_63 t_69 t_68 t_73 t_13 t_14 t_46 t_43 t_45 t_42 t_50 t_56 t_16 t_65 t_30 t_32 t_86 t_25 t_24 t_23 t_22 t_101 t_29 t_17 t_19 t_81 t_34 t_12 t_62 t_11 t_10 t_9 t_67 t_15 t_47 t_37 t_38 t_96 t_27 t_28 t_98 t_49| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -fmodule-file=../../.install/pcm/iterator_0.~hdr.pcm -fmodule-file=../../.install/pcm/format_0.~hdr.pcm -fmodule-file=../../.install/pcm/thread_0.~hdr.pcm -fmodule-file=../../.install/pcm/map_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_map_0.~hdr.pcm -fmodule-file=../../.install/pcm/unordered_set_0.~hdr.pcm -fmodule-file=../../.install/pcm/system_error_0.~hdr.pcm -fmodule-file=../../.install/pcm/memory_0.~hdr.pcm -fmodule-file=../../.install/pcm/filesystem_0.~hdr.pcm -fmodule-file=../../.install/pcm/optional_0.~hdr.pcm -fmodule-file=../../.install/pcm/vector_0.~hdr.pcm -fmodule-file=../../.install/pcm/chrono_0.~hdr.pcm -fmodule-file=../../.install/pcm/string_0.~hdr.pcm -fmodule-file=../../.install/pcm/algorithm_0.~hdr.pcm -fmodule-file=../../.install/pcm/cctype_0.~hdr.pcm -fmodule-file=../../.install/pcm/fstream_0.~hdr.pcm -fmodule-file=../../.install/pcm/iostream_0.~hdr.pcm -fmodule-file=../../.install/pcm/stdexcept_0.~hdr.pcm -fmodule-file=../../.install/pcm/exception_0.~hdr.pcm -fmodule-file=../../.install/pcm/array_0.~hdr.pcm -Wno-experimental-header-units -fprebuilt-module-path=../../.install/pcm -c ../../src/cairn/main.cpp -o ../../.install/obj/main_f4ce731b09f65819.o
 
-t_54:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile string -o ../../.install/pcm/string_0.~hdr.pcm
+t_54: t_0 t_1 t_2 t_3 t_4 t_5 t_6 t_7 t_8 t_9 t_10 t_11 t_12 t_13 t_14 t_15 t_16 t_17 t_18 t_19 t_20 t_21 t_22 t_23 t_24 t_25 t_26 t_27 t_28 t_29 t_30 t_31 t_32 t_33 t_34 t_35 t_36 t_37 t_38 t_39 t_40 t_41 t_42 t_43 t_44 t_45 t_46 t_47 t_48 t_49 t_50 t_51 t_52 t_53| workdir 
+	cd .install; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG ../.install/obj/main_f4ce731b09f65819.o ../.install/obj/fd_streambuf_9a8dee51f130cf79.o ../.install/obj/worker_f4ce731b09f65819.o ../.install/obj/utf_8_9a8dee51f130cf79.o ../.install/obj/build_plan_f4ce731b09f65819.o ../.install/obj/function_view_9a8dee51f130cf79.o ../.install/obj/factory_4b9f900a6746ec2b.o ../.install/obj/factory_6d1f761ca92595d0.o ../.install/obj/artifact_cache_f4ce731b09f65819.o ../.install/obj/stats_9a8dee51f130cf79.o ../.install/obj/module_database_f4ce731b09f65819.o ../.install/obj/serialization_rules_9a8dee51f130cf79.o ../.install/obj/remote_executor_f4ce731b09f65819.o ../.install/obj/compiler_fake_6d1f761ca92595d0.o ../.install/obj/factory_2f01e9763865527e.o ../.install/obj/factory_d52495085800088b.o ../.install/obj/builder_f4ce731b09f65819.o ../.install/obj/compile_commands_supp.ifc_f4ce731b09f65819.o ../.install/obj/script_build_f4ce731b09f65819.o ../.install/obj/hash_9a8dee51f130cf79.o ../.install/obj/cli_f4ce731b09f65819.o ../.install/obj/compile_commands_supp_f4ce731b09f65819.o ../.install/obj/jobserver_9a8dee51f130cf79.o ../.install/obj/log_9a8dee51f130cf79.o ../.install/obj/arguments_9a8dee51f130cf79.o ../.install/obj/log.ifc_9a8dee51f130cf79.o ../.install/obj/file_watcher_9a8dee51f130cf79.o ../.install/obj/compiler_clang_2f01e9763865527e.o ../.install/obj/module_database.ifc_f4ce731b09f65819.o ../.install/obj/module_resolver_f4ce731b09f65819.o ../.install/obj/trace_9a8dee51f130cf79.o ../.install/obj/compiler_msvc_d52495085800088b.o ../.install/obj/remote_protocol_f4ce731b09f65819.o ../.install/obj/scanner_f4ce731b09f65819.o ../.install/obj/preprocess.ifc_f4ce731b09f65819.o ../.install/obj/module_type_f4ce731b09f65819.o ../.install/obj/origin_env_f4ce731b09f65819.o ../.install/obj/abstract_compiler_f4ce731b09f65819.o ../.install/obj/env_9a8dee51f130cf79.o ../.install/obj/thread_pool_9a8dee51f130cf79.o ../.install/obj/load_monitor_9a8dee51f130cf79.o ../.install/obj/source_def_f4ce731b09f65819.o ../.install/obj/simple_json_9a8dee51f130cf79.o ../.install/obj/process_9a8dee51f130cf79.o ../.install/obj/version_f4ce731b09f65819.o ../.install/obj/compile_target_f4ce731b09f65819.o ../.install/obj/compiler_gcc_4b9f900a6746ec2b.o ../.install/obj/version_9a8dee51f130cf79.o ../.install/obj/module_resolver.ifc_f4ce731b09f65819.o ../.install/obj/preprocess_f4ce731b09f65819.o ../.install/obj/p1689_scanner_f4ce731b09f65819.o ../.install/obj/gnu_compiler_setup_f4ce731b09f65819.o ../.install/obj/serializer_9a8dee51f130cf79.o ../.install/obj/process_posix_9a8dee51f130cf79.o -o ../.install/cairn
 
 t_55:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile stdexcept -o ../../.install/pcm/stdexcept_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile unordered_set -o ../../.install/pcm/unordered_set_0.~hdr.pcm
 
 t_56:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile exception -o ../../.install/pcm/exception_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile chrono -o ../../.install/pcm/chrono_0.~hdr.pcm
 
 t_57:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile algorithm -o ../../.install/pcm/algorithm_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile unordered_map -o ../../.install/pcm/unordered_map_0.~hdr.pcm
 
 t_58:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile unordered_map -o ../../.install/pcm/unordered_map_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile atomic -o ../../.install/pcm/atomic_0.~hdr.pcm
 
 t_59:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile variant -o ../../.install/pcm/variant_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile thread -o ../../.install/pcm/thread_0.~hdr.pcm
 
 t_60:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile charconv -o ../../../.install/pcm/charconv_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile functional -o ../../.install/pcm/functional_0.~hdr.pcm
 
 t_61:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile format -o ../../.install/pcm/format_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile span -o ../../.install/pcm/span_0.~hdr.pcm
 
 t_62:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile string_view -o ../../.install/pcm/string_view_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile iostream -o ../../.install/pcm/iostream_0.~hdr.pcm
 
 t_63:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile type_traits -o ../../.install/pcm/type_traits_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile memory -o ../../.install/pcm/memory_0.~hdr.pcm
 
 t_64:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile condition_variable -o ../../../.install/pcm/condition_variable_0.~hdr.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile numeric -o ../../../.install/pcm/numeric_0.~hdr.pcm
 
 t_65:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile queue -o ../../.install/pcm/queue_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile string -o ../../.install/pcm/string_0.~hdr.pcm
 
 t_66:| workdir 
 	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile mutex -o ../../.install/pcm/mutex_0.~hdr.pcm
 
 t_67:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile thread -o ../../.install/pcm/thread_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile stdexcept -o ../../.install/pcm/stdexcept_0.~hdr.pcm
 
 t_68:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile fstream -o ../../.install/pcm/fstream_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile optional -o ../../.install/pcm/optional_0.~hdr.pcm
 
 t_69:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile ostream -o ../../.install/pcm/ostream_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile filesystem -o ../../.install/pcm/filesystem_0.~hdr.pcm
 
 t_70:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile sstream -o ../../.install/pcm/sstream_0.~hdr.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstddef -o ../../../.install/pcm/cstddef_0.~hdr.pcm
 
 t_71:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile array -o ../../.install/pcm/array_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile system_error -o ../../.install/pcm/system_error_0.~hdr.pcm
 
 t_72:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile functional -o ../../.install/pcm/functional_0.~hdr.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cerrno -o ../../../.install/pcm/cerrno_0.~hdr.pcm
 
 t_73:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile iterator -o ../../.install/pcm/iterator_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile vector -o ../../.install/pcm/vector_0.~hdr.pcm
 
 t_74:| workdir 
-	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile regex -o ../../../../.install/pcm/regex_0.~hdr.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstring -o ../../../.install/pcm/cstring_0.~hdr.pcm
 
 t_75:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cctype -o ../../.install/pcm/cctype_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile utility -o ../../.install/pcm/utility_0.~hdr.pcm
 
 t_76:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile atomic -o ../../.install/pcm/atomic_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile type_traits -o ../../.install/pcm/type_traits_0.~hdr.pcm
 
 t_77:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile map -o ../../.install/pcm/map_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile set -o ../../.install/pcm/set_0.~hdr.pcm
 
 t_78:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile chrono -o ../../.install/pcm/chrono_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile map -o ../../.install/pcm/map_0.~hdr.pcm
 
 t_79:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile set -o ../../.install/pcm/set_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstdint -o ../../.install/pcm/cstdint_0.~hdr.pcm
 
 t_80:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cwctype -o ../../../.install/pcm/cwctype_0.~hdr.pcm
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile concepts -o ../../../.install/pcm/concepts_0.~hdr.pcm
 
 t_81:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile streambuf -o ../../../.install/pcm/streambuf_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile fstream -o ../../.install/pcm/fstream_0.~hdr.pcm
 
 t_82:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile utility -o ../../.install/pcm/utility_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstdlib -o ../../.install/pcm/cstdlib_0.~hdr.pcm
 
 t_83:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cstdint -o ../../../.install/pcm/cstdint_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile limits -o ../../.install/pcm/limits_0.~hdr.pcm
 
 t_84:| workdir 
-	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile concepts -o ../../../.install/pcm/concepts_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile deque -o ../../.install/pcm/deque_0.~hdr.pcm
 
 t_85:| workdir 
-	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile unordered_set -o ../../.install/pcm/unordered_set_0.~hdr.pcm
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile charconv -o ../../.install/pcm/charconv_0.~hdr.pcm
 
 t_86:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile algorithm -o ../../.install/pcm/algorithm_0.~hdr.pcm
+
+t_87:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile sstream -o ../../.install/pcm/sstream_0.~hdr.pcm
+
+t_88:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile string_view -o ../../.install/pcm/string_view_0.~hdr.pcm
+
+t_89:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile condition_variable -o ../../.install/pcm/condition_variable_0.~hdr.pcm
+
+t_90:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile queue -o ../../.install/pcm/queue_0.~hdr.pcm
+
+t_91:| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cwctype -o ../../../.install/pcm/cwctype_0.~hdr.pcm
+
+t_92:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile tuple -o ../../.install/pcm/tuple_0.~hdr.pcm
+
+t_93:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile format -o ../../.install/pcm/format_0.~hdr.pcm
+
+t_94:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile variant -o ../../.install/pcm/variant_0.~hdr.pcm
+
+t_95:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile iterator -o ../../.install/pcm/iterator_0.~hdr.pcm
+
+t_96:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile exception -o ../../.install/pcm/exception_0.~hdr.pcm
+
+t_97:| workdir 
+	cd src/cairn/compilers/clang; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile regex -o ../../../../.install/pcm/regex_0.~hdr.pcm
+
+t_98:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile array -o ../../.install/pcm/array_0.~hdr.pcm
+
+t_99:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile ostream -o ../../.install/pcm/ostream_0.~hdr.pcm
+
+t_100:| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile bit -o ../../../.install/pcm/bit_0.~hdr.pcm
+
+t_101:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile cctype -o ../../.install/pcm/cctype_0.~hdr.pcm
+
+t_102:| workdir 
+	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile random -o ../../.install/pcm/random_0.~hdr.pcm
+
+t_103:| workdir 
 	cd src/cairn; ${CLANG}  -I../../src/cairn/utils -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile ranges -o ../../.install/pcm/ranges_0.~hdr.pcm
 
+t_104:| workdir 
+	cd src/cairn/utils; ${CLANG}  -Wall -Wextra -Wpedantic -std=c++20 -O3 -DNDEBUG -Xclang -fretain-comments-from-system-headers -Wno-pragma-system-header-outside-header -fmodule-header=system -xc++-system-header --precompile streambuf -o ../../../.install/pcm/streambuf_0.~hdr.pcm
+
 
 workdir:
 	mkdir -p ./.install
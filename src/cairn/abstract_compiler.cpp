@@ -13,6 +13,8 @@ import cairn.origin_env;
 import cairn.source_scanner;
 import cairn.utils.process;
 import cairn.utils.log;
+import cairn.utils.stats;
+import cairn.utils.hash;
 import cairn.utils.env;
 import cairn.compile_commands;
 import <string_view>;
@@ -20,6 +22,10 @@ import <format>;
 import <filesystem>;
 import <vector>;
 import <span>;
+import <functional>;
+import <memory>;
+import <algorithm>;
+import <chrono>;
 
 
 
@@ -29,9 +35,19 @@ public:
 
     
 
+    ///Single executed command (for tracing)
+    struct Phase {
+        std::string_view name;          ///<name of the phase (for example "bmi", "object")
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+        int status = 0;                 ///<exit status
+    };
+
     struct CompileResult {
         std::filesystem::path interface;
         std::filesystem::path object;
+        std::size_t peak_memory = 0;    ///<peak memory used by the compiler in bytes (0 - unknown)
+        std::vector<Phase> phases = {}; ///<executed commands (filled by asynchronous compilation)
     };
 
     struct ModuleMapping: SourceDef {
@@ -43,6 +59,8 @@ public:
         std::vector<ArgumentString> compile_options;
         std::vector<ArgumentString> link_options;
         std::filesystem::path working_directory;
+        bool p1689_scan = false;                ///<scan by the compiler's dependency scanner (P1689)
+        std::filesystem::path p1689_scanner;    ///<path to clang-scan-deps (empty - find automatically)
     };
 
     struct BuildSystemConfig {
@@ -55,6 +73,10 @@ public:
     ///performs actions to prepare compiler for build (for example creates working directory)
     virtual void prepare_for_build() = 0;
 
+    ///releases caches of the previous build (memoized headers, macros)
+    /** Called between builds (--watch), while no scan is running */
+    virtual void reset_caches() {}
+
     virtual std::string_view get_compiler_name() const = 0;
 
     ///Initialize module map
@@ -104,7 +126,36 @@ public:
         std::span<const SourceDef> modules,
         CompileResult &result) const = 0;
     
+    ///Called when asynchronous compilation is finished
+    /**
+     * @param status compilation status, 0 = success
+     * @param result compile results
+     */
+    using CompileCallback = std::function<void(int status, const CompileResult &result)>;
 
+    ///Compile source file asynchronously
+    /**
+     * Starts compilation and returns immediately. The callback is called 
+     * when compilation is done (can be called from a different thread). 
+     * Arguments are processed before function returns, so they don't need
+     * to stay valid
+     * 
+     * Default implementation performs synchronous compilation
+     * 
+     * @param env environment of file's origin
+     * @param source path to compiled source
+     * @param modules list of module mapping 
+     * @param cb callback
+     */
+    virtual void compile_async(
+        const OriginEnv &env,
+        const SourceDef &source,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const {
+            CompileResult result;
+            int r = compile(env, source, modules, result);
+            cb(r, result);
+    }
 
     ///Perform link operation
     /**
@@ -140,6 +191,25 @@ public:
      */
     virtual SourceScanner::Info scan(const OriginEnv &env, const std::filesystem::path &file) const = 0;
 
+    ///Scan multiple files of the same origin
+    /**
+     * Default implementation scans files one by one. A compiler with an external
+     * dependency scanner can scan all files by single invocation
+     *
+     * @param env source origin
+     * @param files files to scan
+     * @return information for each file (in order of files)
+     */
+    virtual std::vector<SourceScanner::Info> scan_batch(const OriginEnv &env, std::span<const std::filesystem::path> files) const {
+        std::vector<SourceScanner::Info> out;
+        out.reserve(files.size());
+        for (const auto &f: files) out.push_back(scan(env, f));
+        return out;
+    }
+
+    ///Count of files, which should be passed to scan_batch() at once (1 - no batching)
+    virtual std::size_t scan_batch_size() const {return 1;}
+
 
     enum class SourceStatus {
         not_modified,
@@ -147,14 +217,47 @@ public:
         not_exist
     };
 
-    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm) const {
+    ///Recorded state of a source file
+    struct FileStamp {
+        std::uint64_t size = 0;
+        std::int64_t mtime = 0;     ///<last write time (ticks of file_time_type)
+        std::uint64_t hash = 0;     ///<hash of the content (0 - unknown)
+    };
+
+    ///Determine whether source file has been modified
+    /**
+     * @param type type of the source
+     * @param file path to the file
+     * @param tm time of the last build. It is used only when the stamp is not known yet
+     * @param stamp recorded stamp of the file. The function updates the stamp. The
+     * content of the file is hashed only when size or last write time is different,
+     * and the file is reported as modified only when the hash is different. So touching
+     * the file or switching branches back and forth doesn't cause rebuild
+     * @return status of the file
+     */
+    virtual SourceStatus source_status(ModuleType type, const std::filesystem::path &file, 
+                std::filesystem::file_time_type tm, FileStamp &stamp) const {
+        static auto &cnt_checked = Stats::counter("sources.checked");
+        static auto &cnt_hashed = Stats::counter("sources.hashed");
+        static auto &cnt_bytes = Stats::counter("sources.bytes_hashed", Stats::Unit::bytes);
+        cnt_checked.add();
         std::error_code ec;
         auto lwt = std::filesystem::last_write_time(file, ec);
         if (ec != std::error_code{}) return SourceStatus::not_exist;
-        if (lwt > tm) return SourceStatus::modified;
-        return SourceStatus::not_modified;
-
-
+        auto sz = std::filesystem::file_size(file, ec);
+        if (ec != std::error_code{}) return SourceStatus::not_exist;
+        auto mtime = static_cast<std::int64_t>(lwt.time_since_epoch().count());
+        if (stamp.hash && stamp.size == sz && stamp.mtime == mtime) return SourceStatus::not_modified;
+        cnt_hashed.add();
+        cnt_bytes.add(sz);
+        auto h = hash_file(file);
+        if (!h) return SourceStatus::not_exist;
+        //stamp is not known yet, use the last write time
+        bool modified = stamp.hash?stamp.hash != h:lwt > tm;
+        stamp = {sz, mtime, h};
+        Log::debug("{} - {}", [&]{return file.string();}, 
+                    modified?"content changed":"content not changed (stamp updated)");
+        return modified?SourceStatus::modified:SourceStatus::not_modified;
     }
 
     static constexpr auto compile_flag = ArgumentConstant("--compile:");
@@ -165,15 +268,50 @@ public:
         std::filesystem::create_directories(file_path.parent_path());
     }
 
+    ///Invoke the compiler synchronously
+    /**
+     * @param cfg configuration
+     * @param workdir working directory
+     * @param arguments command line
+     * @param peak_memory optional, updated to peak memory of the process, if it is higher (bytes)
+     * @return exit status
+     */
     int invoke(const Config &cfg, 
         const std::filesystem::path &workdir, 
-        std::span<const ArgumentString> arguments) const;
+        std::span<const ArgumentString> arguments,
+        std::size_t *peak_memory = nullptr) const;
+
+    struct Command {
+        std::string_view phase;                 ///<name of the phase (static string)
+        std::vector<ArgumentString> arguments;  ///<command line
+    };
+
+    struct InvokeResult {
+        int status = 0;                 ///<status of last executed command
+        std::size_t peak_memory = 0;    ///<highest peak memory of executed commands (bytes, 0 - unknown)
+        std::vector<Phase> phases;      ///<executed commands
+    };
+
+    ///Invoke multiple command lines asynchronously
+    /**
+     * Command lines are executed one by one. Execution stops on first failure.
+     * Empty command lines are skipped.
+     * @param cfg configuration
+     * @param workdir working directory
+     * @param commands list of commands
+     * @param cb callback called when execution is done
+     */
+    void invoke_async(const Config &cfg,
+        const std::filesystem::path &workdir,
+        std::vector<Command> commands,
+        std::function<void(const InvokeResult &)> cb) const;
 
     static std::vector<ArgumentString> prepare_args(const OriginEnv &env, const Config &config, char switch_char);
 
 
     static std::filesystem::path intermediate_file( const SourceDef &src, std::string_view ext);
     static void dump_failed_cmdline(const Config &cfg, const std::filesystem::path &workdir, std::span<const ArgumentString> cmdline);
+    static void dump_failed_cmdline(const std::filesystem::path &program, const std::filesystem::path &workdir, std::span<const ArgumentString> cmdline);
     static std::filesystem::path find_in_path(std::filesystem::path name, const SystemEnvironment &env);
 
     void dry_run(bool enabled) {
@@ -182,6 +320,42 @@ public:
 
     virtual std::string preproc_for_test(const std::filesystem::path &file) const = 0;
 
+    ///Determine outputs of the compilation without compiling (for the artifact cache)
+    /**
+     * @param env origin environment
+     * @param src source
+     * @param modules list of required modules
+     * @param result receives paths of the outputs
+     * @retval true outputs are known
+     * @retval false not supported, compilation is not cached
+     */
+    virtual bool get_outputs(const OriginEnv &, const SourceDef &, 
+                std::span<const SourceDef> , CompileResult &) const {
+        return false;
+    }
+
+    ///Command lines of a compilation
+    struct Invocation {
+        std::filesystem::path program;
+        std::filesystem::path workdir;
+        std::vector<Command> commands;
+    };
+
+    ///Determine command lines of the compilation without executing them (for remote execution)
+    /**
+     * @param env origin environment
+     * @param src source
+     * @param modules list of required modules
+     * @param inv receives command lines, they must be executed in order
+     * @param result receives paths of the outputs
+     * @retval true supported
+     * @retval false not supported, compilation must be executed locally
+     */
+    virtual bool get_commands(const OriginEnv &, const SourceDef &,
+                std::span<const SourceDef> , Invocation &, CompileResult &) const {
+        return false;
+    }
+
     ///compiler requires to include header transitive (MSVC)
     virtual bool transitive_headers() const {return false;}
 
@@ -194,12 +368,67 @@ protected:
 
 int AbstractCompiler::invoke(const Config &cfg, 
     const std::filesystem::path &workdir, 
-    std::span<const ArgumentString> arguments) const
+    std::span<const ArgumentString> arguments,
+    std::size_t *peak_memory) const
 {
     if (_disable_build) return 0;
     Process p = Process::spawn(cfg.program_path, workdir, arguments, Process::no_streams);
-    return p.waitpid_status();
+    int r = p.waitpid_status();
+    if (peak_memory) *peak_memory = std::max(*peak_memory, p.peak_memory);
+    return r;
+
+}
+
+void AbstractCompiler::invoke_async(const Config &cfg,
+    const std::filesystem::path &workdir,
+    std::vector<Command> commands,
+    std::function<void(const InvokeResult &)> cb) const
+{
+    if (_disable_build) {
+        cb({});
+        return;
+    }
 
+    struct Sequence {
+        std::filesystem::path program_path;
+        std::filesystem::path workdir;
+        std::vector<Command> commands;
+        std::size_t pos = 0;
+        std::function<void(const InvokeResult &)> cb;
+        InvokeResult result = {};
+
+        static void next(std::shared_ptr<Sequence> seq) {
+            while (seq->pos < seq->commands.size() && seq->commands[seq->pos].arguments.empty()) ++seq->pos;
+            if (seq->pos == seq->commands.size()) {
+                seq->cb(seq->result);
+                return;
+            }
+            try {
+                const auto &args = seq->commands[seq->pos].arguments;
+                auto start = std::chrono::steady_clock::now();
+                Process p = Process::spawn(seq->program_path, seq->workdir, args, Process::no_streams);
+                ProcessMonitor::instance().watch(std::move(p), [seq, start](int status, std::string, std::size_t peak_memory) {
+                    auto &r = seq->result;
+                    r.peak_memory = std::max(r.peak_memory, peak_memory);
+                    r.status = status;
+                    r.phases.push_back({seq->commands[seq->pos].phase, start, std::chrono::steady_clock::now(), status});
+                    if (status) {
+                        dump_failed_cmdline(seq->program_path, seq->workdir, seq->commands[seq->pos].arguments);
+                        seq->cb(r);
+                    } else {
+                        ++seq->pos;
+                        next(std::move(seq));
+                    }
+                });
+            } catch (const std::exception &e) {
+                Log::error("{}", e.what());
+                seq->result.status = -1;
+                seq->cb(seq->result);
+            }
+        }
+    };
+
+    Sequence::next(std::make_shared<Sequence>(Sequence{cfg.program_path, workdir, std::move(commands), 0, std::move(cb)}));
 }
 
 std::filesystem::path AbstractCompiler::intermediate_file(const SourceDef &src, std::string_view ext) {
@@ -236,9 +465,13 @@ std::vector<ArgumentString> AbstractCompiler::prepare_args(const OriginEnv &env,
 }
 
 void AbstractCompiler::dump_failed_cmdline(const Config &cfg, const std::filesystem::path &workdir, std::span<const ArgumentString> cmdline) {
+    dump_failed_cmdline(cfg.program_path, workdir, cmdline);
+}
+
+void AbstractCompiler::dump_failed_cmdline(const std::filesystem::path &program, const std::filesystem::path &workdir, std::span<const ArgumentString> cmdline) {
     Log::error("Failed command: {}", [&]{
         std::ostringstream s;
-        s << cfg.program_path.string();
+        s << program.string();
         for (const auto &x: cmdline) {
             s << " " << std::filesystem::path(x);
         };
@@ -0,0 +1,298 @@
+module;
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+export module cairn.artifact_cache;
+
+import cairn.abstract_compiler;
+import cairn.utils.arguments;
+import cairn.utils.hash;
+import cairn.utils.log;
+import cairn.utils.stats;
+
+import <cstdint>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <functional>;
+import <mutex>;
+import <span>;
+import <string>;
+import <string_view>;
+import <thread>;
+import <unordered_map>;
+import <vector>;
+
+
+///Local content-addressed cache of compiled artifacts (BMIs and objects)
+/**
+ * Entries are keyed by hash of everything, what affects the result of the compilation:
+ * identity of the compiler, command lines, content of the source and its textual
+ * includes and content of imported BMIs. Paths of the build directory are not part
+ * of the key, so the cache can be shared between build directories.
+ *
+ * Entry is a directory <root>/<xx>/<key> containing files "interface" and "object".
+ * The entry is prepared in a temporary directory and renamed, so a reader never
+ * sees incomplete entry.
+ *
+ * Artifacts are copied (reflinked, if the file system supports it). Hard links are
+ * not used, because a compiler can rewrite its output in place, which would
+ * corrupt the entry.
+ */
+export class ArtifactCache {
+public:
+
+    using Key = std::uint64_t;
+
+    /**
+     * @param root cache directory
+     * @param build_dir build directory
+     */
+    ArtifactCache(std::filesystem::path root, const std::filesystem::path &build_dir);
+
+    ///Default location of the cache ($XDG_CACHE_HOME/cairn, ~/.cache/cairn, %LOCALAPPDATA%/cairn)
+    static std::filesystem::path default_path();
+
+    ///Computes key of a compilation
+    class KeyBuilder {
+    public:
+        explicit KeyBuilder(ArtifactCache &cache);
+        void add(std::string_view data);
+        void add(std::uint64_t value);
+        ///add content of a file
+        /** @retval false file cannot be read, the compilation should not be cached */
+        bool add_file(const std::filesystem::path &file);
+        ///add command line
+        /**
+         * @param workdir working directory of the command. Paths inside of the
+         *  working directory and build directory are replaced by placeholders
+         * @param program path to the compiler (identified by its size and last write time)
+         * @param args arguments
+         */
+        void add_command(const std::filesystem::path &workdir, const std::filesystem::path &program,
+                        std::span<const ArgumentString> args);
+        ///Retrieve key
+        Key value() const {return _hash.value();}
+    protected:
+        ArtifactCache &_cache;
+        ContentHash _hash;
+    };
+
+    ///Restore artifacts
+    /**
+     * @param key key of the compilation
+     * @param outputs paths, where the artifacts are restored
+     * @retval true restored (hit)
+     * @retval false not found (miss)
+     */
+    bool restore(Key key, const AbstractCompiler::CompileResult &outputs);
+
+    ///Store artifacts
+    /**
+     * @param key key of the compilation
+     * @param outputs outputs of the compilation
+     */
+    void store(Key key, const AbstractCompiler::CompileResult &outputs);
+
+    const std::filesystem::path &get_root() const {return _root;}
+
+    ///Log count of hits and misses
+    void report() const;
+
+protected:
+    std::filesystem::path _root;
+    ArgumentString _build_dir;
+    std::mutex _mx;
+    ///memo of hashes, keyed by the stamp of the file (files change between builds in --watch)
+    std::unordered_map<std::filesystem::path, AbstractCompiler::FileStamp> _file_hashes;
+
+    std::uint64_t file_hash(const std::filesystem::path &file);
+    std::filesystem::path entry_path(Key key) const;
+    static bool clone_file(const std::filesystem::path &from, const std::filesystem::path &to);
+    static void replace_all(ArgumentString &text, const ArgumentString &what, ArgumentStringView with);
+};
+
+static constexpr std::string_view artifact_names[] = {"interface", "object"};
+static constexpr std::string_view cache_version = "cairn-artifact-cache-1";
+static constexpr auto build_placeholder = ArgumentConstant("<build>");
+static constexpr auto workdir_placeholder = ArgumentConstant("<src>");
+
+ArtifactCache::ArtifactCache(std::filesystem::path root, const std::filesystem::path &build_dir)
+    :_root(std::move(root)), _build_dir(path_arg(build_dir.lexically_normal())) {
+    std::filesystem::create_directories(_root);
+}
+
+std::filesystem::path ArtifactCache::default_path() {
+#ifdef _WIN32
+    if (const char *p = std::getenv("LOCALAPPDATA")) return std::filesystem::path(p)/"cairn";
+#else
+    if (const char *p = std::getenv("XDG_CACHE_HOME"); p && *p) return std::filesystem::path(p)/"cairn";
+    if (const char *p = std::getenv("HOME")) return std::filesystem::path(p)/".cache"/"cairn";
+#endif
+    return std::filesystem::temp_directory_path()/"cairn-cache";
+}
+
+std::uint64_t ArtifactCache::file_hash(const std::filesystem::path &file) {
+    std::error_code ec;
+    auto sz = std::filesystem::file_size(file, ec);
+    if (ec) return 0;
+    auto mtime = static_cast<std::int64_t>(std::filesystem::last_write_time(file, ec).time_since_epoch().count());
+    if (ec) return 0;
+    {
+        std::lock_guard _(_mx);
+        auto iter = _file_hashes.find(file);
+        if (iter != _file_hashes.end() && iter->second.size == sz && iter->second.mtime == mtime) {
+            return iter->second.hash;
+        }
+    }
+    static auto &cnt = Stats::counter("cache.files_hashed");
+    cnt.add();
+    auto h = hash_file(file);
+    std::lock_guard _(_mx);
+    _file_hashes[file] = {sz, mtime, h};
+    return h;
+}
+
+std::filesystem::path ArtifactCache::entry_path(Key key) const {
+    auto name = std::format("{:016x}", key);
+    return _root/name.substr(0,2)/name;
+}
+
+void ArtifactCache::replace_all(ArgumentString &text, const ArgumentString &what, ArgumentStringView with) {
+    if (what.empty()) return;
+    auto pos = text.find(what);
+    while (pos != text.npos) {
+        text.replace(pos, what.size(), with);
+        pos = text.find(what, pos + with.size());
+    }
+}
+
+ArtifactCache::KeyBuilder::KeyBuilder(ArtifactCache &cache):_cache(cache) {
+    add(cache_version);
+}
+
+void ArtifactCache::KeyBuilder::add(std::string_view data) {
+    //length prefix - sequence of items is not ambiguous
+    add(static_cast<std::uint64_t>(data.size()));
+    _hash.update(data);
+}
+
+void ArtifactCache::KeyBuilder::add(std::uint64_t value) {
+    char buff[sizeof(value)];
+    for (auto &c: buff) {
+        c = static_cast<char>(value & 0xFF);
+        value >>= 8;
+    }
+    _hash.update(std::string_view(buff, sizeof(buff)));
+}
+
+bool ArtifactCache::KeyBuilder::add_file(const std::filesystem::path &file) {
+    auto h = _cache.file_hash(file);
+    add(h);
+    return h != 0;
+}
+
+void ArtifactCache::KeyBuilder::add_command(const std::filesystem::path &workdir, const std::filesystem::path &program,
+                        std::span<const ArgumentString> args) {
+    //compiler is identified by its path, size and last write time
+    std::error_code ec;
+    add(program.string());
+    add(static_cast<std::uint64_t>(std::filesystem::file_size(program, ec)));
+    add(static_cast<std::uint64_t>(std::filesystem::last_write_time(program, ec).time_since_epoch().count()));
+    auto wd = path_arg(workdir.lexically_normal());
+    add(static_cast<std::uint64_t>(args.size()));
+    for (ArgumentString a: args) {
+        replace_all(a, _cache._build_dir, build_placeholder);
+        replace_all(a, wd, workdir_placeholder);
+        add(std::string_view(reinterpret_cast<const char *>(a.data()), a.size() * sizeof(a[0])));
+    }
+}
+
+bool ArtifactCache::clone_file(const std::filesystem::path &from, const std::filesystem::path &to) {
+    std::error_code ec;
+    std::filesystem::remove(to, ec);
+#ifdef __linux__
+    int src = ::open(from.c_str(), O_RDONLY|O_CLOEXEC);
+    if (src >= 0) {
+        int dst = ::open(to.c_str(), O_WRONLY|O_CREAT|O_EXCL|O_CLOEXEC, 0644);
+        bool ok = dst >= 0 && ::ioctl(dst, FICLONE, src) == 0;
+        if (dst >= 0) ::close(dst);
+        ::close(src);
+        if (ok) return true;
+        std::filesystem::remove(to, ec);
+    }
+#endif
+    return std::filesystem::copy_file(from, to, ec);
+}
+
+bool ArtifactCache::restore(Key key, const AbstractCompiler::CompileResult &outputs) {
+    static auto &cnt_hit = Stats::counter("cache.hit");
+    static auto &cnt_miss = Stats::counter("cache.miss");
+    static auto &cnt_bytes = Stats::counter("cache.bytes_restored", Stats::Unit::bytes);
+    auto entry = entry_path(key);
+    const std::filesystem::path *targets[] = {&outputs.interface, &outputs.object};
+    std::error_code ec;
+    for (std::size_t i = 0; i < 2; ++i) {
+        if (!targets[i]->empty() && !std::filesystem::is_regular_file(entry/artifact_names[i], ec)) {
+            cnt_miss.add();
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < 2; ++i) {
+        if (targets[i]->empty()) continue;
+        AbstractCompiler::ensure_path_exists(*targets[i]);
+        if (!clone_file(entry/artifact_names[i], *targets[i])) {
+            Log::warning("Artifact cache: failed to restore {}", targets[i]->string());
+            cnt_miss.add();
+            return false;
+        }
+        cnt_bytes.add(std::filesystem::file_size(*targets[i], ec));
+    }
+    cnt_hit.add();
+    return true;
+}
+
+void ArtifactCache::store(Key key, const AbstractCompiler::CompileResult &outputs) {
+    static auto &cnt_stored = Stats::counter("cache.stored");
+    static auto &cnt_bytes = Stats::counter("cache.bytes_stored", Stats::Unit::bytes);
+    auto entry = entry_path(key);
+    std::error_code ec;
+    if (std::filesystem::is_directory(entry, ec)) return;
+    //prepare entry in a private directory, then publish it by rename
+    auto tmp = _root/"tmp"/std::format("{:016x}-{}", key, std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::filesystem::remove_all(tmp, ec);
+    std::filesystem::create_directories(tmp, ec);
+    const std::filesystem::path *sources[] = {&outputs.interface, &outputs.object};
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < 2; ++i) {
+        if (sources[i]->empty()) continue;
+        if (!clone_file(*sources[i], tmp/artifact_names[i])) {
+            Log::warning("Artifact cache: failed to store {}", sources[i]->string());
+            std::filesystem::remove_all(tmp, ec);
+            return;
+        }
+        bytes += static_cast<std::size_t>(std::filesystem::file_size(*sources[i], ec));
+    }
+    std::filesystem::create_directories(entry.parent_path(), ec);
+    std::filesystem::rename(tmp, entry, ec);
+    if (ec) {
+        //other process stored the entry first
+        std::filesystem::remove_all(tmp, ec);
+        return;
+    }
+    cnt_stored.add();
+    cnt_bytes.add(bytes);
+}
+
+void ArtifactCache::report() const {
+    auto hits = Stats::counter("cache.hit").value();
+    auto misses = Stats::counter("cache.miss").value();
+    if (hits || misses) {
+        Log::verbose("Artifact cache: {} hits, {} misses ({})", hits, misses, _root.string());
+    }
+}
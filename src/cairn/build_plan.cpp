@@ -3,6 +3,7 @@ import <span>;
 import <string>;
 import <vector>;
 import <queue>;
+import <algorithm>;
 
 export template<typename Action>
 class BuildPlan {
@@ -11,13 +12,23 @@ public:
 
     using TargetID = std::size_t;
     
-    TargetID create_target(Action action, std::string name) {
+    ///Create new target
+    /**
+     * @param action action to execute
+     * @param name name of the target (for logging)
+     * @param cost estimated cost of the action (any unit, but the same for all targets). It
+     * is used to compute critical path, targets on longer path are dispatched first
+     * @param memory estimated peak memory of the action in bytes (0 - unknown)
+     * @return id of the target
+     */
+    TargetID create_target(Action action, std::string name, std::size_t cost = 1, std::size_t memory = 0) {
         std::size_t out = _items.size();
-        _items.push_back({std::move(action),{},name});
+        _items.push_back({std::move(action),{},{},name, cost, memory});
         return out;
     }
     void add_dependency(TargetID target, TargetID target_depends_on ) {
         _items[target].dependencies.push_back(target_depends_on);
+        _items[target_depends_on].dependents.push_back(target);
     }
 
     enum class TargetState {
@@ -26,21 +37,44 @@ public:
         done
     };
 
+    struct ReadyItem {
+        std::size_t priority;
+        TargetID id;
+        //higher priority first, then by order of creation
+        bool operator<(const ReadyItem &other) const {
+            return priority < other.priority || (priority == other.priority && id > other.id);
+        }
+    };
+
     struct State {
         std::vector<TargetState> _states;
+        std::vector<std::size_t> _priority;     //length of remaining critical path for each target
+        std::vector<std::size_t> _remaining;    //count of unfinished dependencies for each target
+        std::priority_queue<ReadyItem> _ready;  //targets ready to run
+        std::size_t _not_done = 0;              //count of targets not done yet
     };
 
     
 
     State initialize_state() const {
-        return {{_items.size(), TargetState::waiting}};
+        State st{{_items.size(), TargetState::waiting}, compute_critical_path(), 
+                std::vector<std::size_t>(_items.size(), 0), {}, _items.size()};
+        for (TargetID i = 0; i < _items.size(); ++i) {
+            st._remaining[i] = _items[i].dependencies.size();
+            if (st._remaining[i] == 0) st._ready.push({st._priority[i], i});
+        }
+        return st;
     }
 
     ///Enumerate actions and mark them pending
     /**
+     * Actions are enumerated in order of their priority. Target with longest remaining
+     * critical path is enumerated first. Enumeration stops, when the function returns false
+     * 
      * @param state state object
      * @param fn function called for each available target, the function receives Target and Action, 
-     * and must return true to mark target pending, or false to left target waiting
+     * and must return true to mark target pending, or false to left target waiting. The function
+     * can call mark_done() 
      * @retval true all done (there are no dependencies left)
      * @retval false still in progress
      */
@@ -50,39 +84,41 @@ public:
 
         if (state._states.size() != _items.size()) return true;
 
-        bool retval = true;
-        auto titer = _items.begin();
-        for (auto &st: state._states) {
-            if (st != TargetState::done)  {
-                retval = false;
-                if (st == TargetState::waiting) {
-                    bool can_run = true;
-                    for (auto d: titer->dependencies) {
-                        if (state._states[d] != TargetState::done) {
-                            can_run = false;
-                            break;
-                        }
-                    }
-                    if (can_run) {
-                        st = TargetState::pending;
-                        bool r = fn(std::distance(_items.begin(), titer), titer->action);
-                        if (!r) st = TargetState::waiting;
-                    }
-                }
+        while (!state._ready.empty()) {
+            auto itm = state._ready.top();
+            state._ready.pop();
+            state._states[itm.id] = TargetState::pending;
+            if (!fn(itm.id, _items[itm.id].action)) {
+                state._states[itm.id] = TargetState::waiting;
+                state._ready.push(itm);
+                break;
             }
-            ++titer;
         }
-        return retval;
+        return state._not_done == 0;
     }
 
-    static void mark_done(State &state, TargetID target) {
+    ///Mark target done
+    /**
+     * Releases targets which depend on this target and have no other unfinished dependency
+     * @param state state object
+     * @param target target to mark done
+     */
+    void mark_done(State &state, TargetID target) const {
+        if (state._states[target] == TargetState::done) return;
         state._states[target] = TargetState::done;
+        --state._not_done;
+        for (auto d: _items[target].dependents) {
+            if (--state._remaining[d] == 0) state._ready.push({state._priority[d], d});
+        }
     }
 
     struct Item {
         Action action;       //action to execute
         std::vector<std::size_t> dependencies;   //dependencies required to be done (index)
+        std::vector<std::size_t> dependents;     //targets depending on this target (index)
         std::string name;
+        std::size_t cost = 1;                   //estimated cost of the action
+        std::size_t memory = 0;                 //estimated peak memory of the action (bytes)
     };
 
     auto begin() const {return _items.begin();}
@@ -131,6 +167,32 @@ public:
         return maxParallel;
     }
 
+    ///Compute length of critical path from each target to the end of the build
+    /**
+     * @return for each target, sum of costs of the most expensive chain of targets
+     * starting by this target and ending by a target which nobody depends on
+     */
+    std::vector<std::size_t> compute_critical_path() const {
+        std::size_t n = _items.size();
+        std::vector<std::size_t> dependents(n, 0);
+        std::vector<std::size_t> longest_tail(n, 0);
+        std::vector<std::size_t> result(n, 0);
+        for (TargetID i = 0; i < n; ++i) dependents[i] = _items[i].dependents.size();
+        //process targets from the end of the build (reverse topological order)
+        std::queue<TargetID> q;
+        for (TargetID i = 0; i < n; ++i) if (dependents[i] == 0) q.push(i);
+        while (!q.empty()) {
+            TargetID u = q.front();
+            q.pop();
+            result[u] = _items[u].cost + longest_tail[u];
+            for (auto d: _items[u].dependencies) {
+                longest_tail[d] = std::max(longest_tail[d], result[u]);
+                if (--dependents[d] == 0) q.push(d);
+            }
+        }
+        return result;
+    }
+
 protected:
 
     std::vector<Item> _items;
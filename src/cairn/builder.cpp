@@ -6,76 +6,283 @@ export module cairn.builder;
 import cairn.abstract_compiler;
 import cairn.build_plan;
 import cairn.utils.threadpool;
+import cairn.utils.jobserver;
+import cairn.utils.load_monitor;
 import cairn.utils.log;
+import cairn.utils.process;
 import <mutex>;
-import <atomic>;
+import <condition_variable>;
+import <chrono>;
 import <memory>;
+import <algorithm>;
+import <functional>;
+import <optional>;
+import <utility>;
+import <vector>;
 
 
 export class Builder {
 public:
 
+    struct Options {
+        ///continue build after failure
+        bool keep_going = false;
+        ///max count of actions in flight (0 = count of threads)
+        std::size_t jobs = 0;
+        ///optional jobserver
+        JobServer *jobserver = nullptr;
+        ///optional load monitor (adapts count of actions in flight)
+        LoadMonitor *load_monitor = nullptr;
+        ///max sum of estimated peak memory of actions in flight in bytes (0 - unlimited)
+        std::size_t memory_budget = 0;
+    };
+
+    ///How often the scheduler looks for tokens released by other processes
+    static constexpr auto poll_interval = std::chrono::milliseconds(100);
 
+    template<typename Action>
+    static constexpr bool has_run_async = requires(const Action &a, unsigned int lane, std::function<void(bool)> cb) {
+        a.run_async(lane, std::move(cb));
+    };
 
     template<typename Action>
     struct BuildState {
         ThreadPool &_thrp;
         const BuildPlan<Action> &_plan;
         typename BuildPlan<Action>::State _state;
-        std::atomic<bool> _done = {false};
+        bool _done = false;
+        std::condition_variable _done_cond;
         bool _result = false;
         bool _is_stopped = false;
         bool _keep_going = false;
         std::mutex _mx;
         std::size_t _to_compile;
         std::size_t _compiled = 0;
+        std::size_t _running = 0;       //count of actions in flight
+        std::size_t _max_running;       //max allowed actions in flight
+        std::size_t _job_limit;         //max allowed actions in flight (-j)
+        std::size_t _memory_budget;     //max estimated memory of actions in flight (0 - unlimited)
+        std::size_t _memory_running = 0;    //estimated memory of actions in flight
+        JobServer *_jobserver;          //optional jobserver
+        LoadMonitor *_load_monitor;     //optional load monitor (adapts _max_running)
+        bool _implicit_token_used = false;  //implicit job slot is used by an action
+        std::vector<JobServer::Token> _tokens;  //tokens acquired from the jobserver, not used by an action
+        bool _token_wanted = false;     //a ready action waits for a token
+        unsigned int _exchanging = 0;   //count of threads exchanging tokens with the jobserver
+        std::vector<bool> _lanes;       //used lanes (for tracing, lane 0 is reserved)
 
-        BuildState(ThreadPool &pool, const BuildPlan<Action> &plan, bool keep_going)
+        using Token = std::optional<JobServer::Token>;
+
+        BuildState(ThreadPool &pool, const BuildPlan<Action> &plan, const Options &opts)
             :_thrp(pool), _plan(plan), _state(plan.initialize_state())
-            ,_keep_going(keep_going), _to_compile(plan.get_plan().size()) {}
+            ,_keep_going(opts.keep_going), _to_compile(plan.get_plan().size())
+            ,_max_running(opts.jobs?opts.jobs:std::max<std::size_t>(1,pool.size()))
+            ,_job_limit(_max_running)
+            ,_memory_budget(opts.memory_budget)
+            ,_jobserver(opts.jobserver)
+            ,_load_monitor(opts.load_monitor) {}
 
         static void start(std::shared_ptr<BuildState> st) {
-            std::lock_guard<std::mutex> _(st->_mx);
-            next_step(std::move(st));
+            {
+                std::lock_guard<std::mutex> _(st->_mx);
+                next_step(st);
+            }
+            exchange_tokens(st);
         }
 
+        ///Dispatch ready actions
+        /**
+         * Actions are not queued to the thread pool all at once. Only as many actions
+         * as allowed jobs are in flight, the rest is kept in the plan. This ensures,
+         * that the most critical target ready in the moment when a slot becomes free
+         * is always dispatched first. 
+         * 
+         * If the action supports asynchronous execution (run_async), the thread
+         * is only used to start the action, so count of jobs can exceed count of 
+         * threads
+         * 
+         * If jobserver is active, every action except the one running on the
+         * implicit slot must take a token before it is dispatched. Only tokens
+         * already acquired by exchange_tokens() are used, the jobserver is never
+         * accessed under the lock. When no token is available, there is no free slot
+         * 
+         * If load monitor is active, count of actions in flight is adjusted
+         * according to the system load
+         * 
+         * If memory budget is set, the action is dispatched only if sum of estimated
+         * memory of actions in flight fits to the budget. At least one action
+         * is always dispatched. The action waits for memory even if there are smaller
+         * actions ready, so large actions on the critical path are not starved
+         */
         static void next_step(std::shared_ptr<BuildState> st) {
+            if (st->_load_monitor) {
+                st->_max_running = st->_load_monitor->adjust(st->_max_running, st->_job_limit);
+            }
+            st->_token_wanted = false;
             bool done = st->_plan.prepare_actions(st->_state, [&](auto id, const Action &action){
-                st->_thrp.push([st, &action, id]() noexcept {
+                if (st->_running >= st->_max_running) return false;
+                auto memory = st->_plan.get_plan()[id].memory;
+                if (st->_memory_budget && st->_running 
+                        && st->_memory_running + memory > st->_memory_budget) return false;
+                bool implicit = !st->_implicit_token_used;
+                Token token;
+                if (st->_jobserver && !implicit) {
+                    if (st->_tokens.empty()) {
+                        st->_token_wanted = true;
+                        return false;
+                    }
+                    token = st->_tokens.back();
+                    st->_tokens.pop_back();
+                }
+                st->_implicit_token_used = true;
+                ++st->_running;
+                st->_memory_running += memory;
+                unsigned int lane = st->acquire_lane();
+                st->_thrp.push([st, &action, id, implicit, token, lane]() noexcept {
                     std::unique_lock<std::mutex> lk(st->_mx);
-                    if (st->_is_stopped) return;
+                    if (st->_is_stopped) {
+                        st->release_slot(id, implicit, token, lane);
+                        st->check_done();
+                        return;
+                    }
                     lk.unlock();                    
-                    bool ok = action();
-                    lk.lock();
-                    ++st->_compiled;
-                    Log::verbose("[{:3}%] {}", (st->_compiled * 100 + st->_to_compile/2)/st->_to_compile, st->_plan.get_plan()[id].name);
-                    st->_plan.mark_done(st->_state, id);
-                    if (ok || st->_keep_going) next_step(st);
-                    else st->finish(false);
+                    if constexpr(has_run_async<Action>) {
+                        action.run_async(lane, [st, id, implicit, token, lane](bool ok) {
+                            on_finished(st, id, ok, implicit, token, lane);
+                        });
+                    } else {
+                        on_finished(st, id, action(), implicit, token, lane);
+                    }
                 });
                 return true;
             });
             if (done) st->finish(true);
         }
 
+        static void on_finished(const std::shared_ptr<BuildState> &st, typename BuildPlan<Action>::TargetID id, 
+                                bool ok, bool implicit, Token token, unsigned int lane) {
+            {
+                std::lock_guard<std::mutex> _(st->_mx);
+                st->release_slot(id, implicit, token, lane);
+                ++st->_compiled;
+                Log::verbose("[{:3}%] {}", (st->_compiled * 100 + st->_to_compile/2)/st->_to_compile, st->_plan.get_plan()[id].name);
+                st->_plan.mark_done(st->_state, id);
+                if (!st->_is_stopped) {
+                    if (ok || st->_keep_going) next_step(st);
+                    else st->finish(false);
+                }
+                st->check_done();
+            }
+            exchange_tokens(st);
+        }
+
+        ///Exchanges tokens with the jobserver (called without the lock)
+        /**
+         * Tokens are acquired while a ready action waits for one, and returned
+         * once no action waits for them
+         */
+        static void exchange_tokens(const std::shared_ptr<BuildState> &st) {
+            if (!st->_jobserver) return;
+            std::unique_lock<std::mutex> lk(st->_mx);
+            if (st->_done) return;
+            //the build doesn't end (and the jobserver is not destroyed) during the exchange
+            ++st->_exchanging;
+            while (true) {
+                std::vector<JobServer::Token> surplus;
+                std::size_t want = 0;
+                if (st->_token_wanted && !st->_is_stopped) {
+                    std::size_t free_slots = st->_max_running > st->_running?st->_max_running - st->_running:0;
+                    want = free_slots > st->_tokens.size()?free_slots - st->_tokens.size():0;
+                } else {
+                    std::swap(surplus, st->_tokens);
+                }
+                lk.unlock();
+                for (auto t: surplus) st->_jobserver->release(t);
+                std::vector<JobServer::Token> acquired;
+                while (acquired.size() < want) {
+                    auto t = st->_jobserver->try_acquire();
+                    if (!t.has_value()) break;
+                    acquired.push_back(*t);
+                }
+                lk.lock();
+                if (acquired.empty()) break;
+                st->_tokens.insert(st->_tokens.end(), acquired.begin(), acquired.end());
+                if (!st->_is_stopped) next_step(st);
+            }
+            --st->_exchanging;
+            st->check_done();
+        }
+
+        void release_slot(typename BuildPlan<Action>::TargetID id, bool implicit, Token token, unsigned int lane) {
+            --_running;
+            _lanes[lane] = false;
+            _memory_running -= _plan.get_plan()[id].memory;
+            if (implicit) _implicit_token_used = false;
+            if (token.has_value()) _tokens.push_back(*token);
+        }
+
+        ///allocates lowest free lane (lanes are stable slots used for tracing)
+        unsigned int acquire_lane() {
+            unsigned int lane = 1;
+            while (lane < _lanes.size() && _lanes[lane]) ++lane;
+            if (lane >= _lanes.size()) _lanes.resize(lane + 1, false);
+            _lanes[lane] = true;
+            return lane;
+        }
+
         void finish(bool result) {
             if (!_is_stopped) {
                 _is_stopped = true;
                 _result = result;
-                _done = true;
-                _done.notify_all();
+                //results of running compilers are not needed, don't wait for them
+                if (!result && _running) ProcessMonitor::instance().cancel_all();
             }
+            check_done();
         }
-    };
 
+        ///signals the end of the build once all running actions are finished
+        void check_done() {
+            if (_is_stopped && _running == 0 && _exchanging == 0 && !_done) {
+                _done = true;
+                _done_cond.notify_all();
+            }
+        }
 
+        ///Waits for the end of the build
+        /**
+         * With jobserver, the scheduler is woken up periodically, because tokens
+         * released by other processes are not signaled. With load monitor, the load
+         * is sampled also while long actions are running, not only when they finish
+         */
+        static void wait(std::shared_ptr<BuildState> st) {
+            std::unique_lock<std::mutex> lk(st->_mx);
+            std::chrono::milliseconds interval = st->_jobserver?poll_interval
+                    :std::chrono::duration_cast<std::chrono::milliseconds>(LoadMonitor::sample_interval);
+            while (!st->_done) {
+                if (st->_jobserver || st->_load_monitor) {
+                    st->_done_cond.wait_for(lk, interval);
+                    if (!st->_done && !st->_is_stopped) next_step(st);
+                    lk.unlock();
+                    exchange_tokens(st);
+                    lk.lock();
+                } else {
+                    st->_done_cond.wait(lk);
+                }
+            }
+            //return tokens of actions finished after the stop
+            std::vector<JobServer::Token> tokens;
+            std::swap(tokens, st->_tokens);
+            lk.unlock();
+            for (auto t: tokens) st->_jobserver->release(t);
+        }
+    };
 
     template<typename Action>
     requires(std::is_nothrow_invocable_r_v<bool, Action>)
-    static bool build(ThreadPool &tp, const BuildPlan<Action> &plan, bool keep_going) {
-        auto st = std::make_shared<BuildState<Action> >(tp, plan, keep_going);
+    static bool build(ThreadPool &tp, const BuildPlan<Action> &plan, const Options &opts) {
+        auto st = std::make_shared<BuildState<Action> >(tp, plan, opts);
         BuildState<Action>::start(st);
-        st->_done.wait(false);        
+        BuildState<Action>::wait(st);
         return st->_result;
 
 
@@ -4,7 +4,10 @@ import cairn.utils.arguments;
 import cairn.utils.log;
 import cairn.version;
 import cairn.compile_target;
+import cairn.remote.protocol;
 import <filesystem>;
+import <limits>;
+import <string>;
 import <vector>;
 
 export struct AppSettings {
@@ -33,13 +36,27 @@ export struct AppSettings {
     std::filesystem::path scan_file = {};
     std::filesystem::path script_name = {};
     std::filesystem::path preproc_file = {};
+    std::filesystem::path trace_file = {};
+    std::filesystem::path stats_file = {};
+    std::filesystem::path cache_dir = {};
+    std::filesystem::path p1689_scanner = {};
+    std::filesystem::path secret_file = {};
+    std::vector<std::string> remote_workers = {};
+    std::string worker_address = {};
     unsigned int threads = 1;
+    std::size_t memory_budget = 0;
     Mode mode = compile_and_link;
     bool show_help = false;
     bool recompile = false;
     bool keep_going = false;
     bool drop_database = false;
     bool list = false;
+    bool jobserver = false;
+    bool adaptive = false;
+    bool stats = false;
+    bool cache = false;
+    bool p1689 = false;
+    bool watch = false;
     ScriptType script_type = none;    
 
 };
@@ -79,8 +96,9 @@ cairn [...switches...] <output1=file1.cpp> [<output2=file2.cpp>... ] <compiler>
 
 Switches
 ========
--jN       specify count of threads
--p<type>  select compiler type: gcc|clang|msvc
+-jN       specify count of parallel jobs (also count of threads scanning sources)
+-p<type>  select compiler type: gcc|clang|msvc|fake
+          (fake - simulated compiler for benchmarking, see README)
 -c<path>  generate compile_commands.json (path=where)
 -f<file>  specify environment file (modules.yaml) for this build
 -B<dir>   specify build directory
@@ -96,6 +114,35 @@ Switches
           create targets (works well with clang++ v18+) 
 -S<file>  don't compile, create BAT script containing all build steps needs to 
           create targets (works well with cl.exe) 
+--jobserver  act as GNU make jobserver for compilers (for example -flto=jobserver).
+          When cairn runs under make with jobserver, it always acts as a client 
+--adaptive  adapt count of parallel jobs (1...N) to memory and cpu pressure and 
+          system load
+--mem-budget=<size>  limit sum of expected memory of parallel jobs (for example 24G).
+          Peak memory of each compilation is recorded in the database, 
+          unknown compilations are expected to need 1G 
+--trace=<file.json>  write trace of the build (chrome://tracing, ui.perfetto.dev)
+--stats   print internal statistics at exit (phase times, files checked and hashed,
+          processes spawned, database size)
+--stats=<file.json>  write internal statistics to a json file 
+--cache   use local artifact cache of BMIs and objects ($XDG_CACHE_HOME/cairn or 
+          ~/.cache/cairn). The cache can be shared between build directories
+--cache=<dir>  use artifact cache in given directory
+--p1689   scan sources by the compiler's dependency scanner (P1689) instead of
+          the internal preprocessor. clang uses clang-scan-deps (found next to
+          the compiler) for many files at once, gcc uses -fdeps-format=p1689r5
+--p1689=<path>  use given clang-scan-deps
+--remote=<host:port>[,<host:port>...]  execute compilations on remote workers 
+          (cairn-worker). Workers must have the same compiler and system headers.
+          Use -j to set count of local jobs, slots of workers are added
+--worker[=<[host:]port>] <compiler>  run as compile worker, which executes only
+          the given compiler. Without host, it listens on 127.0.0.1 (default
+          port 7590). -jN sets count of parallel compilations. Same as running
+          cairn-worker
+--secret=<file>  shared secret of --remote and --worker (content of the file).
+          Required when the worker listens on a network address
+--watch   after the build, keep running and watch sources, headers and origins.
+          Changed files are rescanned and targets are rebuilt immediately
 
 outputN   specifies path/name of output executable
 fileN.cpp specifies path/name of main file for this executable
@@ -166,6 +213,47 @@ cairn --preproc <file.cpp> <compiler> <flags> - run internal preprocessor
 
 )help";
 
+static constexpr auto mem_budget_sw = ArgumentConstant("mem-budget=");
+static constexpr auto trace_sw = ArgumentConstant("trace=");
+static constexpr auto stats_sw = ArgumentConstant("stats=");
+static constexpr auto cache_sw = ArgumentConstant("cache=");
+static constexpr auto p1689_sw = ArgumentConstant("p1689=");
+static constexpr auto remote_sw = ArgumentConstant("remote=");
+static constexpr auto worker_sw = ArgumentConstant("worker=");
+static constexpr auto secret_sw = ArgumentConstant("secret=");
+
+static std::string narrow(ArgumentStringView text) {
+    std::string out;
+    for (auto c: text) out.push_back(static_cast<char>(c));
+    return out;
+}
+
+///parse size with optional suffix K, M, G, T. Returns 0 on error (including overflow)
+static std::size_t parse_size(ArgumentStringView text) {
+    constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
+    std::size_t n = 0;
+    std::size_t pos = 0;
+    while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+        auto d = static_cast<std::size_t>(text[pos] - '0');
+        if (n > (max - d) / 10) return 0;
+        n = n * 10 + d;
+        ++pos;
+    }
+    if (pos == 0) return 0;
+    if (pos == text.size()) return n;
+    if (pos + 1 != text.size()) return 0;
+    unsigned int shift;
+    switch (text[pos]) {
+        case 't': case 'T': shift = 40; break;
+        case 'g': case 'G': shift = 30; break;
+        case 'm': case 'M': shift = 20; break;
+        case 'k': case 'K': shift = 10; break;
+        default: return 0;
+    }
+    if (n > (max >> shift)) return 0;
+    return n << shift;
+}
+
 bool parse_cmdline(AppSettings &settings, CliReader<ArgumentString::value_type> &cli) {
     ArgumentString file;
     auto curdir = std::filesystem::current_path();
@@ -194,6 +282,61 @@ bool parse_cmdline(AppSettings &settings, CliReader<ArgumentString::value_type>
             } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("list")) {
                 settings.list = true;                
                 continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("jobserver")) {
+                settings.jobserver = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("adaptive")) {
+                settings.adaptive = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("stats")) {
+                settings.stats = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(stats_sw)) {
+                settings.stats = true;
+                settings.stats_file = (curdir/ArgumentStringView(p.long_sw).substr(stats_sw.size())).lexically_normal();
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("watch")) {
+                settings.watch = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("cache")) {
+                settings.cache = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(cache_sw)) {
+                settings.cache = true;
+                settings.cache_dir = (curdir/ArgumentStringView(p.long_sw).substr(cache_sw.size())).lexically_normal();
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("p1689")) {
+                settings.p1689 = true;
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(p1689_sw)) {
+                settings.p1689 = true;
+                settings.p1689_scanner = (curdir/ArgumentStringView(p.long_sw).substr(p1689_sw.size())).lexically_normal();
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(remote_sw)) {
+                auto lst = ArgumentStringView(p.long_sw).substr(remote_sw.size());
+                while (!lst.empty()) {
+                    auto n = lst.find(static_cast<ArgumentString::value_type>(','));
+                    auto item = lst.substr(0, n);
+                    if (!item.empty()) settings.remote_workers.push_back(narrow(item));
+                    lst = n == lst.npos?ArgumentStringView():lst.substr(n+1);
+                }
+                continue;
+            } else if (ArgumentStringView(p.long_sw) == ArgumentConstant("worker")) {
+                settings.worker_address = std::to_string(default_worker_port);
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(worker_sw)) {
+                settings.worker_address = narrow(ArgumentStringView(p.long_sw).substr(worker_sw.size()));
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(secret_sw)) {
+                settings.secret_file = (curdir/ArgumentStringView(p.long_sw).substr(secret_sw.size())).lexically_normal();
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(trace_sw)) {
+                settings.trace_file = (curdir/ArgumentStringView(p.long_sw).substr(trace_sw.size())).lexically_normal();
+                continue;
+            } else if (ArgumentStringView(p.long_sw).starts_with(mem_budget_sw)) {
+                settings.memory_budget = parse_size(ArgumentStringView(p.long_sw).substr(mem_budget_sw.size()));
+                if (!settings.memory_budget) return false;
+                continue;
             } else {
                 return false;
             }
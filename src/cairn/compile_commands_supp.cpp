@@ -4,6 +4,7 @@ import cairn.utils.arguments;
 import cairn.utils.hash;
 import cairn.utils.utf8;
 import cairn.utils.simple_json;
+import cairn.utils.stats;
 
 import <filesystem>;
 import <fstream>;
@@ -39,6 +40,8 @@ void CompileCommandsTable::load(std::filesystem::path p)
             rc.file = jf != obj.end() ? std::filesystem::path(u8_from_string(jf->second.as_string())) : std::filesystem::path();
             rc.output = joutput != obj.end() ? std::filesystem::path(u8_from_string(joutput->second.as_string())) : std::filesystem::path();
 
+            static auto &exists_cnt = Stats::counter("compile_commands.files_checked");
+            exists_cnt.add();
             if (std::filesystem::exists(rc.file)) {
                 update(std::move(rc));
             }
@@ -13,9 +13,10 @@ import cairn.source_def;
 import cairn.source_scanner;
 import cairn.utils.env;
 import cairn.utils.log;
-import cairn.utils.threadpool;
+import cairn.utils.stats;
 import cairn.preprocess;
 import cairn.gnu_compiler_setup;
+import cairn.p1689_scanner;
 
 import <algorithm>;
 import <filesystem>;
@@ -38,6 +39,7 @@ public:
     }
 
     virtual void prepare_for_build() override;
+    virtual void reset_caches() override;
 
 
     virtual int compile(
@@ -45,10 +47,18 @@ public:
         const SourceDef &src,
         std::span<const SourceDef> modules,
         CompileResult &result) const override;
+
+    virtual void compile_async(
+        const OriginEnv &env,
+        const SourceDef &src,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const override;
     
     virtual int link(std::span<const std::filesystem::path> objects, const std::filesystem::path &target) const override;
 
     virtual SourceScanner::Info scan(const OriginEnv &env, const std::filesystem::path &file) const override;
+    virtual std::vector<SourceScanner::Info> scan_batch(const OriginEnv &env, std::span<const std::filesystem::path> files) const override;
+    virtual std::size_t scan_batch_size() const override {return _scan_deps.empty()?1:64;}
 
     CompilerClang(Config config);
 
@@ -85,16 +95,23 @@ public:
     });
 
 
-    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm) const override;
+    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const override;
 
     virtual std::string preproc_for_test(const std::filesystem::path &file) const override;
 
+    virtual bool get_outputs(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, CompileResult &result) const override;
+
+    virtual bool get_commands(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, Invocation &inv, CompileResult &result) const override;
+
 protected:
     Config _config;
     std::filesystem::path _module_cache;
     std::filesystem::path _object_cache;
     Version _version;
     StupidPreprocessor _preproc;
+    std::filesystem::path _scan_deps;   ///<clang-scan-deps, if P1689 scanning is enabled
   
 
     std::filesystem::path get_bmi_path(const SourceDef &src) const {
@@ -117,21 +134,15 @@ protected:
         CompileResult &result) const;
     
 
-    static Version get_clang_version(Config &cfg);
-};
+    static Version get_clang_version(const std::string &banner);
+    static std::filesystem::path find_scan_deps(const std::filesystem::path &compiler, const SystemEnvironment &env);
 
+    SourceScanner::Info scan_preprocessor(const OriginEnv &env, const std::filesystem::path &file) const;
+    void resolve_references(const OriginEnv &env, SourceScanner::Info &info) const;
+};
 
-Version CompilerClang::get_clang_version(Config &cfg) {
-    std::vector<ArgumentString> args;    
-    append_arguments(args, {"--version"},{});
-    auto p = Process::spawn(cfg.program_path, cfg.working_directory, args, Process::output);
-
-    std::string banner((std::istreambuf_iterator<char>(*p.stdout_stream)),
-                     std::istreambuf_iterator<char>());
-    if (p.waitpid_status() != 0) {
-        throw std::runtime_error("CLANG: unable to get version of compiler: " + cfg.program_path.string());
-    }
 
+Version CompilerClang::get_clang_version(const std::string &banner) {
     // Extract version from banner (e.g., "clang version 14.0.6")
     std::regex version_regex(R"((\d+\.\d+(?:\.\d+)?))");
     std::smatch match;
@@ -155,16 +166,40 @@ CompilerClang::CompilerClang(Config config) :_config((std::move(config))) {
     _module_cache = _config.working_directory / "pcm";
     _object_cache = _config.working_directory / "obj";
 
-    _version  = get_clang_version(_config);
+    auto probe = probe_gnu_compiler(_config.program_path, _config.compile_options, _config.working_directory);
+    _version  = get_clang_version(probe.version_banner);
 
     if (_version < Version("18.0")) {
         throw std::runtime_error("CLANG: version 18.0 or higher is required. Found: " + _version.to_string());
     }
 
-    ThreadPool tp;
-    tp.start(1);
-    _preproc = initialize_preprocesor_using_gnu_compiler(_config.program_path, _config.compile_options, tp);
+    _preproc = initialize_preprocesor_using_gnu_compiler(probe);
 
+    if (_config.p1689_scan) {
+        _scan_deps = _config.p1689_scanner.empty()?find_scan_deps(_config.program_path, env):_config.p1689_scanner;
+        std::filesystem::create_directories(_config.working_directory/"p1689");
+        Log::debug("CLANG: dependency scanner: {}", [&]{return _scan_deps.string();});
+    }
+
+}
+
+std::filesystem::path CompilerClang::find_scan_deps(const std::filesystem::path &compiler, const SystemEnvironment &env) {
+    //clang++-18 -> clang-scan-deps-18
+    auto name = compiler.filename().string();
+    for (std::string_view pfx: {"clang++", "clang"}) {
+        if (name.starts_with(pfx)) {
+            name = "clang-scan-deps" + name.substr(pfx.size());
+            break;
+        }
+    }
+    auto candidate = compiler.parent_path()/name;
+    std::error_code ec;
+    if (std::filesystem::is_regular_file(candidate, ec)) return candidate;
+    return find_in_path(name, env);
+}
+
+void CompilerClang::reset_caches() {
+    _preproc.reset_caches();
 }
 
 void CompilerClang::prepare_for_build() {
@@ -204,16 +239,66 @@ int CompilerClang::link(std::span<const std::filesystem::path> objects, const st
 }
 
 SourceScanner::Info CompilerClang::scan(const OriginEnv &env, const std::filesystem::path &file) const
+{
+    if (!_scan_deps.empty()) return std::move(scan_batch(env, {&file, 1}).front());
+    return scan_preprocessor(env, file);
+}
+
+SourceScanner::Info CompilerClang::scan_preprocessor(const OriginEnv &env, const std::filesystem::path &file) const
 {
     auto args = prepare_args(env,_config,'-');
     auto preproc = _preproc;
-    auto info =  SourceScanner::scan_string(run_preprocess(preproc, args, env.working_dir, file));
+    auto info =  run_scan(preproc, args, env.working_dir, file);
+    resolve_references(env, info);
+    info.includes = preproc.get_included_files();
+    return info;
+}
+
+std::vector<SourceScanner::Info> CompilerClang::scan_batch(const OriginEnv &env, std::span<const std::filesystem::path> files) const
+{
+    if (_scan_deps.empty()) return AbstractCompiler::scan_batch(env, files);
+    static auto &fallbacks = Stats::counter("scanner.p1689_fallbacks");
+    auto args = prepare_args(env,_config,'-');
+    auto res = run_clang_scan_deps(_scan_deps, _config.program_path, args, env.working_dir, files, _config.working_directory/"p1689");
+    std::vector<SourceScanner::Info> out;
+    out.reserve(files.size());
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (res[i].has_value()) {
+            resolve_references(env, *res[i]);
+            out.push_back(std::move(*res[i]));
+        } else {
+            //the compiler will report errors, but the file needs some result to be built
+            Log::debug("CLANG: not scanned by {}, using internal scanner: {}", [&]{return _scan_deps.string();}, [&]{return files[i].string();});
+            fallbacks.add();
+            out.push_back(scan_preprocessor(env, files[i]));
+        }
+    }
+    return out;
+}
+
+void CompilerClang::resolve_references(const OriginEnv &env, SourceScanner::Info &info) const
+{
     for (auto &s: info.required) {
         if (s.type == ModuleType::user_header) {
             s.name = (env.working_dir/s.name).lexically_normal().string();
         }
     }
-    return info;
+}
+
+bool CompilerClang::get_outputs(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, CompileResult &result) const {
+    build_arguments(true, env, src, modules, result);
+    build_arguments(false, env, src, modules, result);
+    return true;
+}
+
+bool CompilerClang::get_commands(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, Invocation &inv, CompileResult &result) const {
+    inv.program = _config.program_path;
+    inv.workdir = env.working_dir;
+    inv.commands.push_back({"bmi", build_arguments(true, env, src, modules, result)});
+    inv.commands.push_back({"object", build_arguments(false, env, src, modules, result)});
+    return true;
 }
 
 
@@ -294,7 +379,7 @@ int CompilerClang::compile(const OriginEnv &env,
     {
         auto args = build_arguments(true, env, source, modules, result);
         if (!args.empty()) {
-            int r = invoke(_config, env.working_dir, args);
+            int r = invoke(_config, env.working_dir, args, &result.peak_memory);
             if (r) {
                 dump_failed_cmdline(_config, env.working_dir, args);;
                 return r;   
@@ -304,7 +389,7 @@ int CompilerClang::compile(const OriginEnv &env,
     {
         auto args = build_arguments(false, env, source, modules, result);
         if (!args.empty()) {
-            int r = invoke(_config, env.working_dir, args);
+            int r = invoke(_config, env.working_dir, args, &result.peak_memory);
             if (r) {
                 dump_failed_cmdline(_config, env.working_dir, args);;
                 return r;
@@ -315,6 +400,21 @@ int CompilerClang::compile(const OriginEnv &env,
     
 }
 
+void CompilerClang::compile_async(const OriginEnv &env,
+        const SourceDef &source,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const {
+    CompileResult result;
+    Invocation inv;
+    get_commands(env, source, modules, inv, result);
+    invoke_async(_config, env.working_dir, std::move(inv.commands), 
+        [result = std::move(result), cb = std::move(cb)](const InvokeResult &r) mutable {
+            result.peak_memory = r.peak_memory;
+            result.phases = r.phases;
+            cb(r.status, result);
+    });
+}
+
 void CompilerClang::generate_compile_commands(CompileCommandCB cb,  const OriginEnv &env, 
                 const SourceDef &src, std::span<const SourceDef> modules) const  {
 
@@ -329,11 +429,11 @@ void CompilerClang::generate_compile_commands(CompileCommandCB cb,  const Origin
     } 
 }
 
-CompilerClang::SourceStatus CompilerClang::source_status(ModuleType t, const std::filesystem::path &file, std::filesystem::file_time_type tm) const
+CompilerClang::SourceStatus CompilerClang::source_status(ModuleType t, const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const
 {
     //in case of clang we cannot detect a change in system header
     if (t == ModuleType::system_header) return SourceStatus::not_modified;
-    return AbstractCompiler::source_status(t,file,tm);
+    return AbstractCompiler::source_status(t,file,tm,stamp);
 }
 
 std::unique_ptr<AbstractCompiler> create_compiler_clang(AbstractCompiler::Config cfg) {
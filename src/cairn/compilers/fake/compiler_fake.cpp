@@ -0,0 +1,354 @@
+module cairn.compiler.fake;
+
+import cairn.compile_commands;
+import cairn.utils.log;
+import cairn.module_type;
+import cairn.utils.arguments;
+import cairn.abstract_compiler;
+import cairn.origin_env;
+import cairn.source_def;
+import cairn.source_scanner;
+import cairn.preprocess;
+import cairn.gnu_compiler_setup;
+
+import <chrono>;
+import <condition_variable>;
+import <cstdlib>;
+import <filesystem>;
+import <fstream>;
+import <functional>;
+import <iterator>;
+import <memory>;
+import <mutex>;
+import <queue>;
+import <span>;
+import <string>;
+import <thread>;
+import <vector>;
+import <format>;
+
+///Calls functions at given time from a single thread
+/**
+ * Simulated compilations don't occupy a thread while they are "running"
+ */
+class FakeTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ~FakeTimer() {
+        {
+            std::lock_guard _(_mx);
+            _stop = true;
+        }
+        _cond.notify_all();
+        if (_thr.joinable()) _thr.join();
+    }
+
+    void schedule(Clock::time_point tp, std::function<void()> fn) {
+        std::lock_guard _(_mx);
+        if (!_thr.joinable()) _thr = std::thread([this]{worker();});
+        _queue.push({tp, std::move(fn)});
+        _cond.notify_all();
+    }
+
+protected:
+    struct Item {
+        Clock::time_point tp;
+        std::function<void()> fn;
+        bool operator>(const Item &other) const {return tp > other.tp;}
+    };
+
+    std::mutex _mx;
+    std::condition_variable _cond;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item> > _queue;
+    bool _stop = false;
+    std::thread _thr;
+
+    void worker() {
+        std::unique_lock lk(_mx);
+        while (!_stop) {
+            if (_queue.empty()) {
+                _cond.wait(lk);
+            } else if (auto tp = _queue.top().tp; tp > Clock::now()) {
+                //copy - the queue can be reallocated while waiting
+                _cond.wait_until(lk, tp);
+            } else {
+                auto fn = std::move(const_cast<Item &>(_queue.top()).fn);
+                _queue.pop();
+                lk.unlock();
+                fn();
+                lk.lock();
+            }
+        }
+    }
+};
+
+///Simulated compiler
+/**
+ * Scans sources as a real compiler, but compilation and linking only waits
+ * and creates placeholder files. It is intended to measure overhead of
+ * the orchestration (database, build plan, builder) without a toolchain.
+ *
+ * Options (compiler arguments):
+ *
+ * --fake-time=<ms>       fixed time of every compilation
+ * --fake-base-time=<ms>  base time of compilation for the model (default 20)
+ * --fake-ms-per-kb=<ms>  time per kilobyte of the source for the model (default 2)
+ * --fake-link-time=<ms>  time of linking (default 50)
+ *
+ * Without --fake-time, the time of compilation is base time + size of the source
+ * multiplied by ms-per-kb. Other arguments are used by the scanner (-I, -D) or ignored
+ */
+class CompilerFake : public AbstractCompiler {
+public:
+
+    CompilerFake(Config config);
+
+    virtual std::string_view get_compiler_name() const override {
+        return "fake";
+    }
+
+    virtual void prepare_for_build() override;
+    virtual void reset_caches() override;
+
+    virtual int compile(
+        const OriginEnv &env,
+        const SourceDef &src,
+        std::span<const SourceDef> modules,
+        CompileResult &result) const override;
+
+    virtual void compile_async(
+        const OriginEnv &env,
+        const SourceDef &src,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const override;
+
+    virtual int link(std::span<const std::filesystem::path> objects, const std::filesystem::path &target) const override;
+
+    virtual SourceScanner::Info scan(const OriginEnv &env, const std::filesystem::path &file) const override;
+
+    virtual bool initialize_build_system(BuildSystemConfig ) override {
+        return false;
+    }
+
+    virtual bool commit_build_system() override {
+        return false;
+    }
+
+    virtual void generate_compile_commands(CompileCommandCB cc,  const OriginEnv &env,
+                const SourceDef &src, std::span<const SourceDef> modules) const override;
+    virtual void generate_link_command(CompileCommandCB cc,
+                std::span<const std::filesystem::path> objects, const std::filesystem::path &output) const override;
+
+    virtual void initialize_module_map(std::span<const ModuleMapping> ) override {}
+
+    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const override;
+
+    virtual std::string preproc_for_test(const std::filesystem::path &file) const override;
+
+    virtual bool get_outputs(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, CompileResult &result) const override;
+
+    static constexpr auto opt_time = ArgumentConstant("--fake-time=");
+    static constexpr auto opt_base_time = ArgumentConstant("--fake-base-time=");
+    static constexpr auto opt_ms_per_kb = ArgumentConstant("--fake-ms-per-kb=");
+    static constexpr auto opt_link_time = ArgumentConstant("--fake-link-time=");
+
+protected:
+    Config _config;
+    std::filesystem::path _module_cache;
+    std::filesystem::path _object_cache;
+    StupidPreprocessor _preproc;
+    double _fixed_time = -1;
+    double _base_time = 20;
+    double _ms_per_kb = 2;
+    double _link_time = 50;
+    mutable FakeTimer _timer;
+
+    std::filesystem::path get_bmi_path(const SourceDef &src) const {
+        auto n = src.name;
+        for (auto &c: n) if (c == ':') c = '-';
+        n.append(".bmi");
+        return _module_cache/std::filesystem::path(n);
+    }
+    std::filesystem::path get_hdr_bmi_path(const SourceDef &src) const {
+        return _module_cache/intermediate_file(src,"~hdr.bmi");
+    }
+    std::filesystem::path get_obj_path(const SourceDef &src) const {
+        return _object_cache/intermediate_file(src,".o");
+    }
+
+    std::chrono::milliseconds compile_time(const SourceDef &src) const;
+    void set_outputs(const SourceDef &src, CompileResult &result) const;
+    void write_outputs(const SourceDef &src, const CompileResult &result) const;
+
+    static double parse_number(ArgumentStringView v);
+};
+
+double CompilerFake::parse_number(ArgumentStringView v) {
+    std::string s;
+    for (auto c: v) s.push_back(static_cast<char>(c));
+    return std::strtod(s.c_str(), nullptr);
+}
+
+CompilerFake::CompilerFake(Config config):_config(std::move(config)) {
+    _module_cache = _config.working_directory / "bmi";
+    _object_cache = _config.working_directory / "obj";
+    for (ArgumentStringView opt: _config.compile_options) {
+        if (opt.starts_with(opt_time)) _fixed_time = parse_number(opt.substr(opt_time.size()));
+        else if (opt.starts_with(opt_base_time)) _base_time = parse_number(opt.substr(opt_base_time.size()));
+        else if (opt.starts_with(opt_ms_per_kb)) _ms_per_kb = parse_number(opt.substr(opt_ms_per_kb.size()));
+        else if (opt.starts_with(opt_link_time)) _link_time = parse_number(opt.substr(opt_link_time.size()));
+    }
+    _preproc.define_symbol("__cplusplus", "202002L");
+    _preproc.freeze_macros();
+}
+
+void CompilerFake::reset_caches() {
+    _preproc.reset_caches();
+}
+
+void CompilerFake::prepare_for_build() {
+    std::filesystem::create_directories(_module_cache);
+    std::filesystem::create_directories(_object_cache);
+}
+
+std::chrono::milliseconds CompilerFake::compile_time(const SourceDef &src) const {
+    double ms = _fixed_time;
+    if (ms < 0) {
+        std::error_code ec;
+        auto sz = is_header_module(src.type)?0:std::filesystem::file_size(src.path, ec);
+        if (ec != std::error_code{}) sz = 0;
+        ms = _base_time + _ms_per_kb * static_cast<double>(sz) / 1024.0;
+    }
+    return std::chrono::milliseconds(static_cast<long long>(ms));
+}
+
+void CompilerFake::set_outputs(const SourceDef &src, CompileResult &result) const {
+    switch (src.type) {
+        case ModuleType::user_header:
+        case ModuleType::system_header:
+            result.interface = get_hdr_bmi_path(src);
+            break;
+        case ModuleType::interface:
+        case ModuleType::partition:
+            result.interface = get_bmi_path(src);
+            result.object = get_obj_path(src);
+            break;
+        default:
+            result.object = get_obj_path(src);
+            break;
+    }
+}
+
+void CompilerFake::write_outputs(const SourceDef &src, const CompileResult &result) const {
+    if (_disable_build) return;
+    if (!result.interface.empty()) {
+        //content of the BMI depends on content of the source
+        std::ifstream in(src.path, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(result.interface, std::ios::out|std::ios::trunc|std::ios::binary);
+        out << "fake bmi: " << src.name << "\n" << std::hash<std::string>()(content) << "\n";
+    }
+    if (!result.object.empty()) {
+        std::ofstream out(result.object, std::ios::out|std::ios::trunc|std::ios::binary);
+        out << "fake object: " << src.path.string() << "\n";
+    }
+}
+
+int CompilerFake::compile(const OriginEnv &,
+        const SourceDef &src,
+        std::span<const SourceDef> ,
+        CompileResult &result) const {
+    auto start = std::chrono::steady_clock::now();
+    set_outputs(src, result);
+    write_outputs(src, result);
+    if (!_disable_build) std::this_thread::sleep_until(start + compile_time(src));
+    result.phases.push_back({"compile", start, std::chrono::steady_clock::now(), 0});
+    return 0;
+}
+
+void CompilerFake::compile_async(const OriginEnv &,
+        const SourceDef &src,
+        std::span<const SourceDef> ,
+        CompileCallback cb) const {
+    auto start = std::chrono::steady_clock::now();
+    CompileResult result;
+    set_outputs(src, result);
+    write_outputs(src, result);
+    if (_disable_build) {
+        cb(0, result);
+        return;
+    }
+    _timer.schedule(start + compile_time(src), [start, result = std::move(result), cb = std::move(cb)]() mutable {
+        result.phases.push_back({"compile", start, std::chrono::steady_clock::now(), 0});
+        cb(0, result);
+    });
+}
+
+int CompilerFake::link(std::span<const std::filesystem::path> objects, const std::filesystem::path &target) const {
+    if (_disable_build) return 0;
+    auto start = std::chrono::steady_clock::now();
+    ensure_path_exists(target);
+    std::ofstream out(target, std::ios::out|std::ios::trunc|std::ios::binary);
+    if (!out) {
+        Log::error("Failed to create output: {}", target.string());
+        return 1;
+    }
+    out << "fake executable\n";
+    for (const auto &o: objects) out << o.string() << "\n";
+    std::this_thread::sleep_until(start + std::chrono::milliseconds(static_cast<long long>(_link_time)));
+    return 0;
+}
+
+SourceScanner::Info CompilerFake::scan(const OriginEnv &env, const std::filesystem::path &file) const {
+    auto args = prepare_args(env,_config,'-');
+    auto preproc = _preproc;
+    auto info =  run_scan(preproc, args, env.working_dir, file);
+    for (auto &s: info.required) {
+        if (s.type == ModuleType::user_header) {
+            s.name = (env.working_dir/s.name).lexically_normal().string();
+        }
+    }
+    info.includes = preproc.get_included_files();
+    return info;
+}
+
+bool CompilerFake::get_outputs(const OriginEnv &, const SourceDef &src, 
+                std::span<const SourceDef> , CompileResult &result) const {
+    set_outputs(src, result);
+    return true;
+}
+
+void CompilerFake::generate_compile_commands(CompileCommandCB cb,  const OriginEnv &env,
+                const SourceDef &src, std::span<const SourceDef> ) const {
+    CompileResult res;
+    auto args = prepare_args(env,_config,'-');
+    set_outputs(src, res);
+    auto out = res.object.empty()?res.interface:res.object;
+    append_arguments(args, {"-c","{}","-o","{}"}, {path_arg(src.path), path_arg(out)});
+    cb(env.working_dir, src.path, out, _config.program_path, std::move(args));
+}
+
+void CompilerFake::generate_link_command(CompileCommandCB cb,
+        std::span<const std::filesystem::path> objects, const std::filesystem::path &output) const {
+    std::vector<ArgumentString> args = _config.link_options;
+    for (const auto &x: objects) args.push_back(path_arg(x));
+    append_arguments(args, {"-o","{}"}, {path_arg(output)});
+    cb(_config.working_directory, {},output, _config.program_path, std::move(args) );
+}
+
+CompilerFake::SourceStatus CompilerFake::source_status(ModuleType t, const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const {
+    if (t == ModuleType::system_header) return SourceStatus::not_modified;
+    return AbstractCompiler::source_status(t,file,tm,stamp);
+}
+
+std::string CompilerFake::preproc_for_test(const std::filesystem::path &file) const {
+    auto args = _config.compile_options;
+    auto preproc = _preproc;
+    return run_preprocess(preproc, args, std::filesystem::current_path(), file);
+}
+
+std::unique_ptr<AbstractCompiler> create_compiler_fake(AbstractCompiler::Config cfg) {
+    return std::make_unique<CompilerFake>(std::move(cfg));
+}
@@ -0,0 +1,6 @@
+export module cairn.compiler.fake;
+
+import cairn.abstract_compiler;
+import <memory>;
+
+export std::unique_ptr<AbstractCompiler> create_compiler_fake(AbstractCompiler::Config );
@@ -2,12 +2,12 @@ module cairn.compiler.gcc;
 
 import cairn.compile_commands;
 import cairn.utils.log;
+import cairn.utils.stats;
 import cairn.utils.utf8;
 import cairn.utils.process;
 import cairn.utils.arguments;
 import cairn.abstract_compiler;
 import cairn.utils.version;
-import cairn.utils.threadpool;
 import cairn.source_scanner;
 import cairn.source_def;
 import cairn.origin_env;
@@ -15,6 +15,7 @@ import cairn.module_type;
 import cairn.utils.env;
 import cairn.preprocess;
 import cairn.gnu_compiler_setup;
+import cairn.p1689_scanner;
 
 import <filesystem>;
 import <iostream>;
@@ -37,6 +38,7 @@ public:
     }
 
     virtual void prepare_for_build() override;
+    virtual void reset_caches() override;
 
 
     virtual int compile(
@@ -44,6 +46,12 @@ public:
         const SourceDef &src,
         std::span<const SourceDef> modules,
         CompileResult &result) const override;
+
+    virtual void compile_async(
+        const OriginEnv &env,
+        const SourceDef &src,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const override;
     
     virtual int link(std::span<const std::filesystem::path> objects, const std::filesystem::path &target) const override;
 
@@ -66,7 +74,7 @@ public:
 
     virtual void initialize_module_map(std::span<const ModuleMapping> ) override;
 
-    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm) const override;
+    virtual SourceStatus source_status(ModuleType , const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const override;
 
         //preprocessor options
     static constexpr auto preproc_D = ArgumentConstant("-D");
@@ -82,6 +90,9 @@ public:
 
     virtual std::string preproc_for_test(const std::filesystem::path &file) const override;
 
+    virtual bool get_outputs(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, CompileResult &result) const override;
+
 protected:
     Config _config;
     std::filesystem::path _module_cache;
@@ -91,7 +102,10 @@ protected:
     StupidPreprocessor _preproc;
     
 
-    static Version get_gcc_version(Config &cfg);
+    static Version get_gcc_version(const std::string &banner);
+
+    SourceScanner::Info scan_preprocessor(const OriginEnv &env, const std::filesystem::path &file) const;
+    void resolve_references(const OriginEnv &env, SourceScanner::Info &info, std::span<const std::filesystem::path> paths) const;
 
     std::vector<ArgumentString> build_arguments(const OriginEnv &env,
         const SourceDef &source,
@@ -102,17 +116,7 @@ protected:
 
 };
 
-Version CompilerGcc::get_gcc_version(Config &cfg) {
-    std::vector<ArgumentString> args;
-    append_arguments(args, {"--version"},{});
-    auto p = Process::spawn(cfg.program_path, cfg.working_directory, args, Process::output);
-
-    std::string banner((std::istreambuf_iterator<char>(*p.stdout_stream)),
-                     std::istreambuf_iterator<char>());
-    if (p.waitpid_status() != 0) {
-        throw std::runtime_error("GCC: unable to get version of compiler: " + cfg.program_path.string());
-    }
-
+Version CompilerGcc::get_gcc_version(const std::string &banner) {
     // Extract version from banner (e.g., "clang version 14.0.6")
     std::regex version_regex(R"((\d+\.\d+(?:\.\d+)?))");
     std::smatch match;
@@ -125,16 +129,43 @@ Version CompilerGcc::get_gcc_version(Config &cfg) {
 
 
 SourceScanner::Info CompilerGcc::scan(const OriginEnv &env, const std::filesystem::path &file) const
+{
+    if (_config.p1689_scan) {
+        static auto &fallbacks = Stats::counter("scanner.p1689_fallbacks");
+        auto args = prepare_args(env,_config,'-');
+        auto nfo = run_gcc_p1689(_config.program_path, args, env.working_dir, file, _config.working_directory/"p1689");
+        if (nfo.has_value()) {
+            auto preproc = _preproc;
+            setup_preprocess(preproc, args, env.working_dir);
+            resolve_references(env, *nfo, preproc.get_include_paths());
+            return std::move(*nfo);
+        }
+        //the compiler will report errors, but the file needs some result to be built
+        Log::debug("GCC: not scanned by the compiler, using internal scanner: {}", [&]{return file.string();});
+        fallbacks.add();
+    }
+    return scan_preprocessor(env, file);
+}
+
+SourceScanner::Info CompilerGcc::scan_preprocessor(const OriginEnv &env, const std::filesystem::path &file) const
 {
     auto args = prepare_args(env,_config,'-');
     auto preproc = _preproc;
-    auto nfo =  SourceScanner::scan_string(run_preprocess(preproc, args, env.working_dir, file));
-    auto paths =  preproc.get_include_paths();
+    auto nfo =  run_scan(preproc, args, env.working_dir, file);
+    resolve_references(env, nfo, preproc.get_include_paths());
+    nfo.includes = preproc.get_included_files();
+    return nfo;
+}
+
+void CompilerGcc::resolve_references(const OriginEnv &env, SourceScanner::Info &nfo, std::span<const std::filesystem::path> paths) const
+{
     for (auto &s: nfo.required) {
         if (s.type == ModuleType::system_header) {
             bool ok = false;
             for (const auto &x: paths) {
                 std::filesystem::path candidate = (x/s.name).lexically_normal();
+                static auto &stat_cnt = Stats::counter("scanner.system_header_probes");
+                stat_cnt.add();
                 std::error_code ec;
                 if (std::filesystem::is_regular_file(candidate, ec)) {
                     s.name = s.name + "@"+candidate.string();
@@ -147,7 +178,12 @@ SourceScanner::Info CompilerGcc::scan(const OriginEnv &env, const std::filesyste
             s.name = s.name + "@" + (env.working_dir/s.name).lexically_normal().string();
         }
     }
-    return nfo;
+}
+
+bool CompilerGcc::get_outputs(const OriginEnv &env, const SourceDef &src, 
+                std::span<const SourceDef> modules, CompileResult &result) const {
+    build_arguments(env, src, modules, result);
+    return true;
 }
 
 
@@ -164,19 +200,25 @@ CompilerGcc::CompilerGcc(Config config):_config(std::move(config)) {
     std::filesystem::create_directories(_module_cache);
     std::filesystem::create_directories(_object_cache);
     
-    _version  = get_gcc_version(_config);
+    auto probe = probe_gnu_compiler(_config.program_path, _config.compile_options, _config.working_directory);
+    _version  = get_gcc_version(probe.version_banner);
 
     if (_version < Version("14.0")) {
         throw std::runtime_error("GCC: version 14.0 or higher is required. Found: " + _version.to_string());
     }
 
 
-    ThreadPool tp;
-    tp.start(1);
-    _preproc = initialize_preprocesor_using_gnu_compiler(_config.program_path, _config.compile_options, tp);
+    _preproc = initialize_preprocesor_using_gnu_compiler(probe);
+    if (_config.p1689_scan) {
+        std::filesystem::create_directories(_config.working_directory/"p1689");
+    }
     
 }
 
+void CompilerGcc::reset_caches() {
+    _preproc.reset_caches();
+}
+
 void CompilerGcc::prepare_for_build() {
     std::filesystem::create_directories(_module_cache);
     std::filesystem::create_directories(_object_cache);
@@ -318,7 +360,7 @@ int CompilerGcc::compile(const OriginEnv &env,
     {
         auto args = build_arguments( env, source, modules, result);
         if (!args.empty()) {
-            int r = invoke(_config, env.working_dir, args);
+            int r = invoke(_config, env.working_dir, args, &result.peak_memory);
             if (r) {
                 dump_failed_cmdline(_config, env.working_dir, args);;
                 return r;   
@@ -329,6 +371,20 @@ int CompilerGcc::compile(const OriginEnv &env,
     
 }
 
+void CompilerGcc::compile_async(const OriginEnv &env,
+        const SourceDef &source,
+        std::span<const SourceDef> modules,
+        CompileCallback cb) const {
+    CompileResult result;
+    std::vector<Command> cmdlines;
+    cmdlines.push_back({"compile", build_arguments(env, source, modules, result)});
+    invoke_async(_config, env.working_dir, std::move(cmdlines), 
+        [result = std::move(result), cb = std::move(cb)](const InvokeResult &r) mutable {
+            result.peak_memory = r.peak_memory;
+            result.phases = r.phases;
+            cb(r.status, result);
+    });
+}
 
 std::unique_ptr<AbstractCompiler> create_compiler_gcc(AbstractCompiler::Config cfg) {
     return std::make_unique<CompilerGcc>(std::move(cfg));
@@ -346,13 +402,13 @@ void CompilerGcc::generate_compile_commands(CompileCommandCB cc,  const OriginEn
 }
 
 AbstractCompiler::SourceStatus CompilerGcc::source_status(ModuleType t,
-        const std::filesystem::path &file, std::filesystem::file_time_type tm) const {
+        const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const {
     if (is_header_module(t)) {
         std::string s = file.string();
         auto [name, path] =  separate_header_ref(s);
-        return AbstractCompiler::source_status(t, path, tm);
+        return AbstractCompiler::source_status(t, path, tm, stamp);
     } else {
-        return AbstractCompiler::source_status(t, file, tm);
+        return AbstractCompiler::source_status(t, file, tm, stamp);
     }
 }
 
@@ -32,6 +32,7 @@ import <iostream>;
 import <string>;
 import <filesystem>;
 import <format>;
+import <algorithm>;
 import <numeric>;
 import <vector>;
 import <map>;
@@ -46,6 +47,7 @@ public:
         return "msvc";
     }
     virtual void prepare_for_build() override;
+    virtual void reset_caches() override;
     virtual int compile(
         const OriginEnv &env,
         const SourceDef &src,
@@ -76,7 +78,7 @@ public:
   };
 
     virtual SourceStatus source_status(ModuleType t, const std::filesystem::path &file, 
-        std::filesystem::file_time_type tm) const override;
+        std::filesystem::file_time_type tm, FileStamp &stamp) const override;
 
     struct EnvironmentCache {
         VariantSpec variant;
@@ -118,7 +120,8 @@ protected:
 
     int invoke( 
         const std::filesystem::path &workdir, 
-        std::span<const ArgumentString> arguments) const;
+        std::span<const ArgumentString> arguments,
+        std::size_t *peak_memory = nullptr) const;
 
     void create_macro_summary_file(const std::filesystem::path &target);
     void initialize_preproc();
@@ -230,6 +233,10 @@ CompilerMSVC::CompilerMSVC(Config config): _config(std::move(config)) {
 
 }
 
+void CompilerMSVC::reset_caches() {
+    _preproc.reset_caches();
+}
+
 void CompilerMSVC::prepare_for_build()
 {
     std::filesystem::create_directories(_module_cache_path);
@@ -240,7 +247,7 @@ int CompilerMSVC::compile(const OriginEnv &env, const SourceDef &src, std::span<
 {
     auto args = build_arguments( env, src, modules, result);
     if (!args.empty()) {
-        int r = invoke( env.working_dir, args);
+        int r = invoke( env.working_dir, args, &result.peak_memory);
         if (r) {
             dump_failed_cmdline(_config, env.working_dir, args);;
             return r;   
@@ -476,13 +483,15 @@ std::string CompilerMSVC::map_module_name(const std::string_view &name) {
 
 
 int CompilerMSVC::invoke(const std::filesystem::path &workdir, 
-    std::span<const ArgumentString> arguments) const
+    std::span<const ArgumentString> arguments,
+    std::size_t *peak_memory) const
 {
     if (_disable_build) return 0;
 
     Process p = Process::spawn(_config.program_path, workdir, arguments, Process::output, _env_cache.env);
     std::string dummy(std::istreambuf_iterator<char>(*p.stdout_stream), std::istreambuf_iterator<char>());
     int r =  p.waitpid_status();
+    if (peak_memory) *peak_memory = std::max(*peak_memory, p.peak_memory);
     int lines =std::accumulate(dummy.begin(), dummy.end(), 0, [](int a, char c){return a+(c == '\n'?1:0);});
     if (lines > 1) {    //attempt to remove filename from output
         Log::verbose("{}", dummy);   //any larger output is displayed
@@ -491,11 +500,11 @@ int CompilerMSVC::invoke(const std::filesystem::path &workdir,
 
 }
 
-CompilerMSVC::SourceStatus CompilerMSVC::source_status(ModuleType t, const std::filesystem::path &file, std::filesystem::file_time_type tm) const
+CompilerMSVC::SourceStatus CompilerMSVC::source_status(ModuleType t, const std::filesystem::path &file, std::filesystem::file_time_type tm, FileStamp &stamp) const
 {
     //in case of clang we cannot detect a change in system header
     if (t == ModuleType::system_header) return SourceStatus::not_modified;
-    return AbstractCompiler::source_status(t,file,tm);
+    return AbstractCompiler::source_status(t,file,tm,stamp);
 }
 
 std::unique_ptr<AbstractCompiler> create_compiler_msvc( AbstractCompiler::Config config) {
@@ -695,6 +704,7 @@ void CompilerMSVC::initialize_preproc() {
         }
     }
     _preproc.append_includes(includes);
+    _preproc.freeze_macros();
 }
 
 std::string CompilerMSVC::run_preproc(std::span<const ArgumentString> args, std::filesystem::path workdir, std::filesystem::path file) const {
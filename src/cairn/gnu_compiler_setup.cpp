@@ -1,10 +1,19 @@
 export module cairn.gnu_compiler_setup;
 
 import cairn.preprocess;
+import cairn.source_scanner;
 import cairn.utils.threadpool;
 import cairn.utils.arguments;
 import cairn.utils.process;
 import cairn.utils.utf8;
+import cairn.utils.log;
+import cairn.utils.stats;
+import cairn.utils.serializer;
+import cairn.utils.serializer.rules;
+import <cstdint>;
+import <cstdlib>;
+import <fstream>;
+import <stdexcept>;
 import <vector>;
 import <atomic>;
 import <string>;
@@ -40,9 +49,71 @@ export inline  std::vector<std::filesystem::path> extract_include_path(std::stri
 
 
 
-export inline StupidPreprocessor initialize_preprocesor_using_gnu_compiler(std::filesystem::path program_path, std::vector<ArgumentString> args, ThreadPool &tp) {
+///Results of probes of a GNU-family compiler
+export struct GnuCompilerProbe {
+    std::string version_banner;                         ///<output of --version
+    std::vector<std::filesystem::path> include_paths;   ///<include search list
+    std::string predefines;                             ///<predefined macros (output of -dM)
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.version_banner, me.include_paths, me.predefines);
+    }
+};
+
+///Identifies compiler and its options, probe is repeated when anything is changed
+struct GnuCompilerProbeKey {
+    std::filesystem::path program_path;
+    std::uintmax_t size = 0;
+    std::int64_t mtime = 0;
+    std::filesystem::path current_dir;
+    std::vector<ArgumentString> compile_options;
+    //environment variables, which extend the include search list
+    std::string cpath;
+    std::string cplus_include_path;
+
+    bool operator==(const GnuCompilerProbeKey &other) const = default;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.program_path, me.size, me.mtime, me.current_dir, me.compile_options,
+             me.cpath, me.cplus_include_path);
+    }
+};
+
+struct GnuCompilerProbeCache {
+    static constexpr std::uint32_t current_format = 2;
+    std::uint32_t format = current_format;
+    GnuCompilerProbeKey key;
+    GnuCompilerProbe probe;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.format);
+        if (me.format == current_format) arch(me.key, me.probe);
+    }
+};
+
+inline std::string probe_gnu_compiler_version(const std::filesystem::path &program_path, const std::filesystem::path &working_dir) {
+    std::vector<ArgumentString> args;
+    append_arguments(args, {"--version"},{});
+    auto p = Process::spawn(program_path, working_dir, args, Process::output);
+
+    std::string banner((std::istreambuf_iterator<char>(*p.stdout_stream)),
+                     std::istreambuf_iterator<char>());
+    if (p.waitpid_status() != 0) {
+        throw std::runtime_error("unable to get version of compiler: " + program_path.string());
+    }
+    return banner;
+}
+
+///Probe include search list and predefined macros
+/**
+ * @return true success, false the compiler failed, the probe can be incomplete
+ */
+inline bool probe_gnu_preprocessor(const std::filesystem::path &program_path, std::vector<ArgumentString> args, 
+                                    const std::filesystem::path &curdir, GnuCompilerProbe &probe) {
 
-    auto curdir =std::filesystem::current_path();
     append_arguments(args, {"-v","-E","-xc++","-dM","-"},{});
     Process p = Process::spawn(program_path, curdir, args, Process::input_output_error);
     p.stdin_stream.reset(); 
@@ -50,6 +121,8 @@ export inline StupidPreprocessor initialize_preprocesor_using_gnu_compiler(std::
     std::string outstr;
     std::string errstr;
     std::atomic<bool> done(false);
+    ThreadPool tp;
+    tp.start(1);
     tp.push([&]() noexcept {
         errstr = std::string(std::istreambuf_iterator<char>(*p.stderr_stream),std::istreambuf_iterator<char>());
         done = true;
@@ -57,14 +130,79 @@ export inline StupidPreprocessor initialize_preprocesor_using_gnu_compiler(std::
     });
     outstr = std::string(std::istreambuf_iterator<char>(*p.stdout_stream),std::istreambuf_iterator<char>());
     done.wait(false);
-    p.waitpid_status();
+    int status = p.waitpid_status();
+
+    probe.include_paths = extract_include_path(errstr, curdir);
+    probe.predefines = std::move(outstr);
+    if (status != 0) {
+        Log::warning("Compiler failed to report include paths and predefined macros: {}\n{}",
+                program_path.string(), errstr);
+        return false;
+    }
+    return true;
+}
+
+///Probes the compiler for version, include search list and predefined macros
+/**
+ * The result is stored in the build directory and reused while the compiler binary
+ * (path, size, modification time), the current directory, the options and the
+ * variables CPATH and CPLUS_INCLUDE_PATH are the same. Failed probe is not stored
+ *
+ * @param program_path path to compiler
+ * @param compile_options options of the compiler
+ * @param working_dir build directory
+ * @return result of probe
+ */
+export inline GnuCompilerProbe probe_gnu_compiler(const std::filesystem::path &program_path, 
+                            std::span<const ArgumentString> compile_options,
+                            const std::filesystem::path &working_dir) {
+
+    auto cache_path = working_dir/"compiler_probe.bin";
+    GnuCompilerProbeCache cache;
+    GnuCompilerProbeKey key;
+    key.program_path = program_path;
+    key.current_dir = std::filesystem::current_path();
+    key.compile_options.assign(compile_options.begin(), compile_options.end());
+    if (const char *v = std::getenv("CPATH")) key.cpath = v;
+    if (const char *v = std::getenv("CPLUS_INCLUDE_PATH")) key.cplus_include_path = v;
+    std::error_code ec;
+    key.size = std::filesystem::file_size(program_path, ec);
+    if (!ec) key.mtime = static_cast<std::int64_t>(std::filesystem::last_write_time(program_path, ec).time_since_epoch().count());
+    bool cacheable = !ec;
+
+    if (cacheable) try {
+        std::ifstream file(cache_path, std::ios::binary);
+        if (file.is_open()) {
+            deserialize_from_stream(file, cache);
+            if (cache.format == GnuCompilerProbeCache::current_format && cache.key == key) {
+                Log::debug("Using cached probe of compiler: {}", [&]{return program_path.string();});
+                return std::move(cache.probe);
+            }
+        }
+    } catch (std::exception &e) {
+        Log::warning("failed to deserialize, dropping cache: {}", e.what());
+    }
+
+    Log::debug("Probing compiler: {}", [&]{return program_path.string();});
+    std::filesystem::create_directories(working_dir);
+    cache = {};
+    cache.key = std::move(key);
+    cache.probe.version_banner = probe_gnu_compiler_version(program_path, working_dir);
+    bool complete = probe_gnu_preprocessor(program_path, cache.key.compile_options, cache.key.current_dir, cache.probe);
+    if (cacheable && complete) {
+        std::ofstream file(cache_path, std::ios::binary|std::ios::trunc);
+        if (file.is_open()) serialize_to_stream(file, cache);
+        else Log::warning("Unable to write compiler probe cache: {}", [&]{return cache_path.string();});
+    }
+    return std::move(cache.probe);
+}
 
-    auto paths = extract_include_path(errstr, curdir);
+///Creates preprocessor with include search list and predefined macros of the compiler
+export inline StupidPreprocessor initialize_preprocesor_using_gnu_compiler(const GnuCompilerProbe &probe) {
     StupidPreprocessor preproc;
-    preproc.append_includes(paths);
-    std::istringstream instr(outstr);
-    std::ostringstream dummy;
-    preproc.run(curdir, instr, StupidPreprocessor::ScanMode::collect, dummy);
+    preproc.append_includes(probe.include_paths);
+    preproc.run(std::filesystem::current_path(), probe.predefines, StupidPreprocessor::ScanMode::collect, {});
+    preproc.freeze_macros();
     return preproc;
 }   
 
@@ -78,10 +216,10 @@ constexpr auto preproc_include_directory = ArgumentConstant("--include-directory
 
 
 
-export inline std::string run_preprocess(StupidPreprocessor &preproc,
+///Apply -D, -U and -I arguments to the preprocessor
+export inline void setup_preprocess(StupidPreprocessor &preproc,
          std::span<const ArgumentString> args,
-         const std::filesystem::path &workdir,
-         const std::filesystem::path &file)  {
+         const std::filesystem::path &workdir)  {
 
     int a = -1;
     for (ArgumentStringView itm: args) {
@@ -129,6 +267,41 @@ export inline std::string run_preprocess(StupidPreprocessor &preproc,
         }
         a = -1;
     }
+}
 
+export inline std::string run_preprocess(StupidPreprocessor &preproc,
+         std::span<const ArgumentString> args,
+         const std::filesystem::path &workdir,
+         const std::filesystem::path &file)  {
+
+    setup_preprocess(preproc, args, workdir);
     return preproc.run(workdir, file);
 }
+
+///Preprocess and scan the file
+/**
+ * Preprocessing stops once the module preamble is complete. Directives of the
+ * global module fragment are still processed, so macros can affect imports.
+ * When there is no directive before end of the preamble, the preprocessor is
+ * skipped and the text is scanned directly
+ */
+export inline SourceScanner::Info run_scan(StupidPreprocessor &preproc,
+         std::span<const ArgumentString> args,
+         const std::filesystem::path &workdir,
+         const std::filesystem::path &file)  {
+
+    static auto &plain = Stats::counter("scanner.without_preprocessor");
+    setup_preprocess(preproc, args, workdir);
+    std::string text;
+    if (!StupidPreprocessor::read_source(file, text)) return {};
+    SourceScanner::Preamble preamble;
+    auto sink = [&](std::string_view ln){return preamble.add_line(ln);};
+    //most preambles have no directives, so the text is scanned directly
+    if (preproc.copy_plain(workdir, text, sink)) {
+        plain.add();
+    } else {
+        preamble = {};
+        preproc.copy(workdir, text, sink);
+    }
+    return preamble.result();
+}
@@ -7,17 +7,28 @@ import cairn.cli;
 import cairn.compiler.clang;
 import cairn.compiler.gcc;
 import cairn.compiler.msvc;
+import cairn.compiler.fake;
 import cairn.utils.log;
+import cairn.utils.env;
 import cairn.module_database;
 import cairn.source_scanner;
 import cairn.module_type;
 import cairn.origin_env;
 import cairn.utils.threadpool;
+import cairn.utils.jobserver;
+import cairn.utils.load_monitor;
+import cairn.utils.trace;
+import cairn.utils.stats;
+import cairn.utils.file_watcher;
 import cairn.compile_commands;
 import cairn.build_plan;
 import cairn.utils.utf8;
 import cairn.module_resolver;
 import cairn.script_build;
+import cairn.artifact_cache;
+import cairn.remote.executor;
+import cairn.remote.protocol;
+import cairn.worker;
 import <vector>;
 import <exception>;
 import <filesystem>;
@@ -32,6 +43,12 @@ import <algorithm>;
 import <iostream>;
 import <thread>;
 import <format>;
+import <optional>;
+import <chrono>;
+import <string>;
+import <cctype>;
+import <iterator>;
+import <stdexcept>;
 
 
 static constexpr auto gcc_type_1 = ArgumentConstant("gcc");
@@ -47,6 +64,11 @@ static constexpr auto msvc_type_2 = ArgumentConstant("msc");
 static constexpr auto msvc_type_3 = ArgumentConstant("cl");
 static constexpr auto msvc_type_4 = ArgumentConstant("cl.exe");
 static constexpr std::array<ArgumentStringView,4> msvc_types = {msvc_type_1, msvc_type_2, msvc_type_3, msvc_type_4};
+static constexpr auto fake_type_1 = ArgumentConstant("fake");
+static constexpr std::array<ArgumentStringView,1> fake_types = {fake_type_1};
+
+///quiet period before rebuild in watch mode (editors save multiple files)
+static constexpr auto watch_debounce = std::chrono::milliseconds(100);
 
 static std::unique_ptr<AbstractCompiler> create_compiler(const AppSettings &settings) {
     auto contains = [](ArgumentStringView what, const auto &where) {
@@ -62,6 +84,8 @@ static std::unique_ptr<AbstractCompiler> create_compiler(const AppSettings &sett
             factory = &create_compiler_clang;
         } else if (contains(settings.compiler_type, msvc_types)) {
             factory = &create_compiler_msvc;
+        } else if (contains(settings.compiler_type, fake_types)) {
+            factory = &create_compiler_fake;
         } else {
             return {};
         }
@@ -89,6 +113,8 @@ static std::unique_ptr<AbstractCompiler> create_compiler(const AppSettings &sett
     cfg.compile_options  = std::move(settings.compiler_arguments);
     cfg.link_options  = std::move(settings.linker_arguments);
     cfg.working_directory = settings.working_directory_path;
+    cfg.p1689_scan = settings.p1689;
+    cfg.p1689_scanner = settings.p1689_scanner;
     std::filesystem::create_directories(cfg.working_directory);
     return factory(std::move(cfg));
 }
@@ -102,6 +128,9 @@ void  load_database(ModuleDatabase &db, const std::filesystem::path &path) {
             Log::warning("Database is corrupted. Rebuilding: {}", e.what());
             db.clear();
         }
+        f.clear();
+        auto sz = f.tellg();
+        if (sz > 0) Stats::counter("database.bytes_read", Stats::Unit::bytes).add(static_cast<std::size_t>(sz));
     }
 }
 
@@ -109,7 +138,20 @@ void  load_database(ModuleDatabase &db, const std::filesystem::path &path) {
 void save_database_binary(const ModuleDatabase &db, const std::filesystem::path &path) {
     std::ofstream f(path, std::ios::out|std::ios::trunc|std::ios::binary);
     db.export_database(f);
+    auto sz = f.tellp();
+    if (sz > 0) Stats::counter("database.bytes_written", Stats::Unit::bytes).add(static_cast<std::size_t>(sz));
+
+}
 
+///read shared secret of remote workers (trailing whitespace is removed)
+static std::string read_secret(const std::filesystem::path &path) {
+    if (path.empty()) return {};
+    std::ifstream f(path, std::ios::in|std::ios::binary);
+    if (!f) throw std::runtime_error("Unable to read the secret: " + path.string());
+    std::string s(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>{});
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back()))) s.pop_back();
+    if (s.empty()) throw std::runtime_error("The secret is empty: " + path.string());
+    return s;
 }
 
 int run_just_preproc(AbstractCompiler &compiler, const std::filesystem::path &file) {    
@@ -271,6 +313,11 @@ int tmain(int argc, ArgumentString::value_type *argv[]) {
         AppSettings settings;
         auto curdir = std::filesystem::current_path();
 
+        //installed as cairn-worker (symlink) - run as compile worker
+        if (std::filesystem::path(argv[0]).stem() == "cairn-worker") {
+            settings.worker_address = std::to_string(default_worker_port);
+        }
+
         if (argc < 2) {
             std::cerr << "Requires command line arguments. Use -h for help\n";
             return 1;
@@ -294,7 +341,24 @@ int tmain(int argc, ArgumentString::value_type *argv[]) {
             return 1;
         }
 
-        auto compiler =create_compiler(settings);
+        if (!settings.worker_address.empty()) {
+            return run_worker({
+                .address = settings.worker_address,
+                .slots = settings.threads?settings.threads:std::max(1U, std::thread::hardware_concurrency()),
+                .compiler = AbstractCompiler::find_in_path(settings.compiler_path, SystemEnvironment::current()),
+                .secret = read_secret(settings.secret_file)
+            });
+        }
+
+        //statistics are reported at exit (even if the build fails)
+        Stats::Report stats_report(settings.stats, settings.stats_file);
+        //trace is written at exit (even if the build fails)
+        Trace::Session trace_session(settings.trace_file);
+
+        auto compiler = [&]{
+            Trace::Scope _("compiler setup");
+            return create_compiler(settings);
+        }();
         if (!compiler) {
             Log::error("Unknown compiler {}. Use -p to specify compiler.",  settings.compiler_path.string());
             std::cerr << "Use -h for help" << "\n";
@@ -312,25 +376,36 @@ int tmain(int argc, ArgumentString::value_type *argv[]) {
         auto db_path = settings.working_directory_path/"modules.db";
 
         ModuleDatabase db;
-        if (!settings.drop_database) load_database(db, db_path);        
-        if (!db.check_database_version(settings.compiler_path, settings.compiler_arguments)) {
-            Log::verbose("Settings has been changed, rebuilding");
+        db.set_scan_threads(settings.threads?settings.threads:std::thread::hardware_concurrency());
+        {
+            Trace::Scope _("load database");
+            if (!settings.drop_database) load_database(db, db_path);        
+            if (!db.check_database_version(settings.compiler_path, settings.compiler_arguments)) {
+                Log::verbose("Settings has been changed, rebuilding");
+            }
         }
 
         POriginEnv default_env = std::make_shared<OriginEnv>(OriginEnv::default_env());
 
-        db.check_for_modifications(*compiler);
+        {
+            Trace::Scope _("check_for_modifications");
+            db.check_for_modifications(*compiler);
+        }
         auto targets = settings.targets;
-        if (!settings.env_file_json.empty()) {
-            auto r = ModuleResolver::loadMap(settings.env_file_json);
-            db.add_origin(r, *compiler);
-            if (!r.targets.empty() && targets.empty()) { 
-                targets = r.targets;
+        {
+            Trace::Scope _("discovery");
+            if (!settings.env_file_json.empty()) {
+                auto r = ModuleResolver::loadMap(settings.env_file_json);
+                db.add_origin(r, *compiler);
+                if (!r.targets.empty() && targets.empty()) { 
+                    targets = r.targets;
+                }
+            }
+            for (const auto &ts: targets) {
+                db.add_file( ts.source, *compiler);
             }
         }
-        for (const auto &ts: targets) {
-            db.add_file( ts.source, *compiler);
-        }
+        Stats::counter("database.entries").set(db.size());
 
         if (settings.script_type != AppSettings::none) {
             auto mplan = db.create_build_plan(*compiler, *default_env, 
@@ -338,7 +413,7 @@ int tmain(int argc, ArgumentString::value_type *argv[]) {
             compiler->dry_run(true);
             ThreadPool tp;
             tp.start(1);
-            Builder::build(tp, mplan, true);
+            Builder::build(tp, mplan, {.keep_going = true});
             if (settings.script_type == AppSettings::makefile) {
                 generate_makefile(mplan, settings.script_name);            
             } else if (settings.script_type == AppSettings::batch) {
@@ -361,55 +436,138 @@ int tmain(int argc, ArgumentString::value_type *argv[]) {
         }
         else db.check_for_recompile();
 
-        auto plan = db.create_build_plan(*compiler, *default_env, 
-                    targets, settings.recompile,  !settings.lib_arguments.empty());
+        std::optional<ArtifactCache> cache;
+        if (settings.cache) {
+            cache.emplace(settings.cache_dir.empty()?ArtifactCache::default_path():settings.cache_dir,
+                        settings.working_directory_path);
+            Log::debug("Artifact cache: {}", [&]{return cache->get_root().string();});
+        }
 
-    
-                
-        if (settings.list) {
-            db.extract_module_mapping(plan, module_map);
-            list_modules(db,module_map);
-            return 0;
+        std::optional<RemoteExecutor> remote;
+        if (!settings.remote_workers.empty()) {
+            Trace::Scope _("connect workers");
+            remote.emplace(settings.remote_workers, 
+                std::vector<std::filesystem::path>{curdir, settings.working_directory_path},
+                read_secret(settings.secret_file));
         }
 
+        bool recompile = settings.recompile;
+        //compiler, database, cache and workers stay resident between builds (--watch)
+        auto run_build = [&]{
+            auto plan = [&]{
+                Trace::Scope _("create_build_plan");
+                return db.create_build_plan(*compiler, *default_env, 
+                        targets, recompile,  !settings.lib_arguments.empty(), 
+                        cache?&*cache:nullptr, remote?&*remote:nullptr);
+            }();
+
+            auto threads = settings.threads;
+            if (threads == 0) threads = std::thread::hardware_concurrency();
+            //local jobs + slots of remote workers
+            if (remote) threads += remote->get_slots();
+            auto paral = plan.computeMaxParallelism(plan);
+            threads = std::min(paral,threads);
+            Log::debug("Using threads {}", threads);
+
+            bool use_build_system = compiler->initialize_build_system({threads, settings.keep_going});
+            if (use_build_system) threads = 1;
+            module_map.clear();
+            db.extract_module_mapping(plan, module_map);
+            compiler->initialize_module_map(module_map);
+            ThreadPool tp;
+            //compilers are executed asynchronously, threads are only needed to start them
+            //(and for synchronous actions), so more jobs than CPUs doesn't need more threads
+            tp.start(std::min(threads, std::max(1U, std::thread::hardware_concurrency())));
+            auto jobserver = JobServer::connect();
+            if (jobserver) {
+                Log::verbose("Using jobserver of parent process");
+            } else if (settings.jobserver && !use_build_system) {
+                jobserver = JobServer::create(threads);
+                Log::verbose("Jobserver started with {} jobs", threads);
+            }
+            std::optional<LoadMonitor> load_monitor;
+            if (settings.adaptive) load_monitor.emplace();
+            bool ret = [&]{
+                Trace::Scope _("build");
+                return Builder::build(tp, plan, {
+                    .keep_going = settings.keep_going,
+                    .jobs = threads,
+                    .jobserver = jobserver.get(),
+                    .load_monitor = load_monitor?&*load_monitor:nullptr,
+                    .memory_budget = settings.memory_budget
+                });
+            }();
+
+            if (cache) cache->report();
+            if (remote) remote->report();
+
+            if (!settings.compile_commands_json.empty()) {
+                Trace::Scope _("compile_commands");
+                Log::debug("Updating compile commands: {}", [&]{return settings.compile_commands_json.string();});
+                CompileCommandsTable cctable;
+                try {
+                    cctable.load(settings.compile_commands_json);
+                } catch (std::exception &e) {
+                    Log::warning("Cannot load {}: {} - rebuilding", settings.compile_commands_json.string(), e.what());
+                }
+                auto genplan = db.create_build_plan(*compiler, *default_env, targets, true,  compile_lib);
+                for (auto &p: genplan.get_plan()) p.action.generate_compile_commands(
+                        [&](const std::filesystem::path &directory,
+                            const std::filesystem::path &input,
+                            const std::filesystem::path &output,
+                            const std::filesystem::path &compiler,
+                            std::vector<ArgumentString> &&arguments){
+                                cctable.update(cctable.record(directory, input,compiler,std::move(arguments), output));
+                        });            
+                cctable.save(settings.compile_commands_json);
+            }
 
-        auto threads = settings.threads;
-        if (threads == 0) threads = std::thread::hardware_concurrency();
-        auto paral = plan.computeMaxParallelism(plan);
-        threads = std::min(paral,threads);
-        Log::debug("Using threads {}", threads);
+            if (db.is_dirty()) {
+                Trace::Scope _("save database");
+                save_database_binary(db, db_path);
+                db.clear_dirty();
+            }
+            return ret;
+        };
 
         compiler->prepare_for_build();
-        bool use_build_system = compiler->initialize_build_system({threads, settings.keep_going});
-        if (use_build_system) threads = 1;
-        db.extract_module_mapping(plan, module_map);
-        compiler->initialize_module_map(module_map);
-        ThreadPool tp;
-        tp.start(threads);
-        bool ret = Builder::build(tp, plan, settings.keep_going);
-
-        if (!settings.compile_commands_json.empty()) {
-            Log::debug("Updating compile commands: {}", [&]{return settings.compile_commands_json.string();});
-            CompileCommandsTable cctable;
-            try {
-                cctable.load(settings.compile_commands_json);
-            } catch (std::exception &e) {
-                Log::warning("Cannot load {}: {} - rebuilding", settings.compile_commands_json.string(), e.what());
+        bool ret = run_build();
+
+        if (settings.watch) {
+            //the loop doesn't end, statistics and trace (totals since start) are written after every build
+            stats_report.emit();
+            Trace::save();
+            recompile = false;
+            FileWatcher watcher;
+            while (true) {
+                std::vector<std::filesystem::path> files;
+                std::vector<std::filesystem::path> directories;
+                db.collect_tracked(files, directories);
+                watcher.watch(files, directories);
+                Log::verbose("Watching {} files and {} directories for changes", files.size(), directories.size());
+                auto changed = watcher.wait(watch_debounce);
+                Log::debug("Changed: {}", [&]{
+                    std::string s;
+                    for (const auto &c: changed) s.append(" ").append(c.string());
+                    return s;
+                });
+                try {
+                    Trace::Scope _("apply_changes");
+                    db.apply_changes(changed, *compiler);
+                    db.check_for_recompile();
+                    ret = run_build();
+                } catch (std::exception &e) {
+                    Log::error("{}", e.what());
+                    ret = false;
+                }
+                if (ret) {
+                    Log::verbose("Done");
+                } else {
+                    Log::error("Failed");
+                }
+                stats_report.emit();
+                Trace::save();
             }
-            auto genplan = db.create_build_plan(*compiler, *default_env, targets, true,  compile_lib);
-            for (auto &p: genplan.get_plan()) p.action.generate_compile_commands(
-                    [&](const std::filesystem::path &directory,
-                        const std::filesystem::path &input,
-                        const std::filesystem::path &output,
-                        const std::filesystem::path &compiler,
-                        std::vector<ArgumentString> &&arguments){
-                            cctable.update(cctable.record(directory, input,compiler,std::move(arguments), output));
-                    });            
-            cctable.save(settings.compile_commands_json);
-        }
-
-        if (db.is_dirty()) {
-            save_database_binary(db, db_path);
         }
 
         if (ret) {
@@ -11,13 +11,23 @@ import cairn.abstract_compiler;
 import cairn.compile_commands;
 import cairn.utils.serializer;
 import cairn.utils.serializer.rules;
+import cairn.utils.trace;
+import cairn.utils.stats;
+import cairn.utils.simple_json;
+import cairn.utils.threadpool;
 
 import <atomic>;
+import <condition_variable>;
+import <exception>;
+import <functional>;
+import <mutex>;
+import <optional>;
 import <ostream>;
 import <queue>;
 import <unordered_set>;
 import <ranges>;
 import <format>;
+import <limits>;
 
 
 
@@ -134,7 +144,9 @@ void ModuleDatabase::check_for_modifications(AbstractCompiler &compiler) {
             to_remove.push_back(p);
             Log::debug("{} - removed file because origin", [&]{return p.string();});
         } else {
-            auto st = compiler.source_status(f->type, p, cmptm);    
+            auto prev_stamp = f->stamp;
+            auto st = compiler.source_status(f->type, p, cmptm, f->stamp);
+            if (f->stamp.hash != prev_stamp.hash || f->stamp.mtime != prev_stamp.mtime) set_dirty();
             if (st != AbstractCompiler::SourceStatus::not_modified) {
                 Log::debug("{} - modified", [&]{return p.string();});
                 rescan.push_back(f);
@@ -144,14 +156,22 @@ void ModuleDatabase::check_for_modifications(AbstractCompiler &compiler) {
 
     for (const auto &p: to_remove) _fileIndex.erase(p);
 
+    std::vector<PSource> sources;
     for (const auto &f: rescan) {
         if (!is_header_module(f->type)) {
-            missing = merge_references(std::move(missing), rescan_file(f->origin, f->source_file, compiler));
+            sources.push_back(f);
         } else {
             f->state.recompile = true;
+            f->state.changed = true;
         }
     }
+    missing = merge_references(std::move(missing), rescan_files(sources, compiler));
 
+    collect_missing(missing);
+    run_discovery(missing, compiler);
+}
+
+void ModuleDatabase::collect_missing(Unsatisfied &missing) const {
     for (const auto &[p, f] : _fileIndex) {
         for (auto &r: f->references) {
             if (find(r) == nullptr) {
@@ -161,9 +181,106 @@ void ModuleDatabase::check_for_modifications(AbstractCompiler &compiler) {
             }
         }
     }
+}
+
+void ModuleDatabase::apply_changes(std::span<const std::filesystem::path> changed, AbstractCompiler &compiler) {
+    //changes made before this point are processed now, later changes are reported
+    //again. The time is stored as modification time of the database
+    _import_time = std::chrono::system_clock::now();
+    //symbols and memoized headers of the previous build are not kept
+    compiler.reset_caches();
+    std::unordered_set<std::filesystem::path> changed_set(changed.begin(), changed.end());
+    Unsatisfied missing;
+
+    //changed origins. Files of a changed YAML origin are removed and the origin
+    //is loaded again. Directory origins are only extended by new files (removed files
+    //are reported separately)
+    std::vector<POriginEnv> origins;
+    for (const auto &[p, org]: _originMap) {
+        if (changed_set.count(p)) origins.push_back(org);
+    }
+    for (const auto &org: origins) {
+        bool is_dir = std::filesystem::is_directory(org->config_file);
+        Log::debug("{} - changed origin", [&]{return org->config_file.string();});
+        if (!is_dir) {
+            std::vector<std::filesystem::path> to_remove;
+            for (const auto &[p, f]: _fileIndex) {
+                if (f->origin == org) to_remove.push_back(p);
+            }
+            for (const auto &p: to_remove) erase(p);
+            _originMap.erase(org->config_file);
+            set_dirty();
+        }
+        std::error_code ec;
+        if (!std::filesystem::exists(org->config_file, ec)) {
+            _originMap.erase(org->config_file);
+            continue;
+        }
+        try {
+            auto r = ModuleResolver::loadMap(org->config_file);
+            //shared by sources of the origin
+            if (is_dir) org->maps = r.env.maps;
+            add_origin_no_discovery(r, compiler, missing);
+        } catch (const std::exception &e) {
+            Log::error("{}: {}", org->config_file.string(), e.what());
+            //keep the origin, so it is still watched and reloaded when fixed
+            _originMap.emplace(org->config_file, org);
+        }
+    }
+
+    //changed sources and sources, which include changed headers
+    std::vector<PSource> rescan;
+    std::vector<std::filesystem::path> to_remove;
+    for (const auto &[p, f]: _fileIndex) {
+        if (changed_set.count(p)) {
+            //reported by the watcher - without recorded stamp the file is modified
+            //(file_time_type{} is not the oldest time, the epoch of the file clock can be in the future)
+            auto st = compiler.source_status(f->type, p, std::filesystem::file_time_type::min(), f->stamp);
+            if (st == AbstractCompiler::SourceStatus::not_exist) {
+                Log::debug("{} - removed", [&]{return p.string();});
+                to_remove.push_back(p);
+            } else if (st == AbstractCompiler::SourceStatus::modified) {
+                Log::debug("{} - modified", [&]{return p.string();});
+                rescan.push_back(f);
+            }
+        } else if (std::any_of(f->includes.begin(), f->includes.end(), [&](const auto &i){
+                    return changed_set.count(i) != 0;})) {
+            Log::debug("{} - included file modified", [&]{return p.string();});
+            rescan.push_back(f);
+        }
+    }
+    for (const auto &p: to_remove) erase(p);
+
+    std::vector<PSource> sources;
+    for (const auto &f: rescan) {
+        if (!is_header_module(f->type)) {
+            sources.push_back(f);
+        } else {
+            f->state.recompile = true;
+            f->state.changed = true;
+        }
+    }
+    missing = merge_references(std::move(missing), rescan_files(sources, compiler));
+    set_dirty();
+    collect_missing(missing);
     run_discovery(missing, compiler);
 }
 
+void ModuleDatabase::collect_tracked(std::vector<std::filesystem::path> &files,
+                                     std::vector<std::filesystem::path> &directories) const {
+    std::unordered_set<std::filesystem::path> includes;
+    for (const auto &[p, f]: _fileIndex) {
+        if (p.is_absolute()) files.push_back(p);
+        includes.insert(f->includes.begin(), f->includes.end());
+    }
+    files.insert(files.end(), includes.begin(), includes.end());
+    for (const auto &[p, o]: _originMap) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(p, ec)) directories.push_back(p);
+        else files.push_back(p);
+    }
+}
+
 void ModuleDatabase::check_for_recompile() {
     //spread recompile flag to other files (by reference)
     //modified?
@@ -179,6 +296,7 @@ void ModuleDatabase::check_for_recompile() {
             //check whether targets exist
                 if ((generates_bmi(f->type) && f->bmi_path.empty()) || (generates_object(f->type) && f->object_path.empty())) {
                     f->state.recompile = true;
+                    f->state.changed = true;
                     Log::debug("{} - missing one of its products - scheduled for recompile", [&]{return f->source_file.string();});
 
                     mod = true;
@@ -220,96 +338,219 @@ ModuleDatabase::Source ModuleDatabase::from_scanner(const std::filesystem::path
     for (const auto &r: nfo.exported) {
         out.exported.push_back(Reference{r.type, r.name});        
     }
+    out.includes = nfo.includes;
     out.source_file = source_file;
     return out;
 }
 
-POriginEnv ModuleDatabase::add_origin_no_discovery(const ModuleResolver::Result &origin, AbstractCompiler &compiler, Unsatisfied &missing) {
-
-    //attempt to find origin to this path
-    //in database
-    auto iter =  _originMap.find(origin.env.config_file);
-
-    if (iter == _originMap.end()) {
-        //really don't known, create it
-        POriginEnv env = std::make_shared<OriginEnv>(origin.env);
-        //add to known origins
-        _originMap.emplace(env->config_file, env);
-        //load allo files
-        for (auto &x: origin.files) {
-            //rescan this file and find unknown references
-            missing = merge_references(std::move(missing),
-                                 rescan_file(env, x, compiler));
-        }
-        return env;
-    }  else {
-        POriginEnv o = iter->second;
-        for (const auto &f: origin.files) {
-            if (!find(f)) {
-                missing = merge_references(missing, rescan_file(o, f, compiler));
+///Scans files in parallel, results are merged into the database by a single thread
+/**
+ * Jobs (scanning of a source, loading of an origin) run on a thread pool. Their
+ * results are applied to the database by the thread, which called run(), so the
+ * database is never accessed concurrently.
+ *
+ * When discovery is enabled, unsatisfied references revealed by a scan start
+ * exploring of origins, which can satisfy them, while other files are still
+ * being scanned
+ */
+class ModuleDatabase::ScanPipeline {
+public:
+
+    ScanPipeline(ModuleDatabase &db, AbstractCompiler &compiler, bool discovery)
+        :_db(db), _compiler(compiler), _discovery(discovery) {}
+
+    ///register origin and schedule scanning of its files
+    /**
+     * Files of a new origin are scanned all. Files of a known origin are scanned
+     * only when they are not in the database
+     */
+    POriginEnv add_origin(const ModuleResolver::Result &origin) {
+        auto iter = _db._originMap.find(origin.env.config_file);
+        if (iter == _db._originMap.end()) {
+            POriginEnv env = std::make_shared<OriginEnv>(origin.env);
+            _db._originMap.emplace(env->config_file, env);
+            for (const auto &f: origin.files) add_file(env, f);
+            return env;
+        } else {
+            POriginEnv o = iter->second;
+            for (const auto &f: origin.files) {
+                if (!_db.find(f)) add_file(o, f);
             }
+            return o;
         }
+    }
 
+    ///schedule scanning of the file
+    /**
+     * Files of an origin are collected to a batch (see AbstractCompiler::scan_batch_size).
+     * The batch is scanned once it is full or when run() is about to wait for results
+     */
+    void add_file(POriginEnv origin, const std::filesystem::path &source_file) {
+        if (!_queued.insert(source_file).second) return;
+        auto iter = std::find_if(_batches.begin(), _batches.end(), [&](const auto &b){return b.first == origin;});
+        if (iter == _batches.end()) iter = _batches.insert(_batches.end(), {origin, {}});
+        iter->second.push_back(source_file);
+        if (iter->second.size() >= _compiler.scan_batch_size()) {
+            auto files = std::move(iter->second);
+            _batches.erase(iter);
+            push_batch(std::move(origin), std::move(files));
+        }
+    }
 
-        return o;
+    ///add unsatisfied references (ordered)
+    void add_missing(Unsatisfied missing) {
+        if (_discovery) {
+            for (const auto &[_,o]: _db._originMap) explore(*o, missing);
+        }
+        _missing = merge_references(std::move(_missing), std::move(missing));
     }
 
-}
+    ///process results until all jobs are done
+    /** @return references, which are still unsatisfied (ordered) */
+    Unsatisfied run() {
+        flush();
+        while (_pending) {
+            std::function<void()> done;
+            {
+                std::unique_lock lk(_mx);
+                _cv.wait(lk, [&]{return !_done.empty();});
+                done = std::move(_done.front());
+                _done.pop();
+            }
+            --_pending;
+            done();
+            flush();
+        }
+        remove_satisfied();
+        return std::move(_missing);
+    }
 
-POriginEnv ModuleDatabase::add_origin_no_discovery(const std::filesystem::path &origin_path, AbstractCompiler &compiler, Unsatisfied &missing) {
+protected:
+    ModuleDatabase &_db;
+    AbstractCompiler &_compiler;
+    bool _discovery;
+    Unsatisfied _missing;
+    std::unordered_set<std::filesystem::path> _queued;
+    std::vector<std::pair<POriginEnv, std::vector<std::filesystem::path> > > _batches;
+    std::unordered_set<std::filesystem::path> _explored;
+    std::size_t _pending = 0;
+    std::mutex _mx;
+    std::condition_variable _cv;
+    std::queue<std::function<void()> > _done;
+    //must be last - running jobs are finished before other members are destroyed
+    ThreadPool _pool;
+
+    ///run job on the pool, its result is passed to apply() in the thread of run()
+    template<typename Job, typename Apply>
+    void push(Job &&job, Apply &&apply) {
+        ++_pending;
+        auto task = [this, job = std::forward<Job>(job), apply = std::forward<Apply>(apply)]() mutable noexcept {
+            std::function<void()> done;
+            try {
+                done = [r = job(), apply = std::move(apply)]() mutable {apply(std::move(r));};
+            } catch (...) {
+                done = [e = std::current_exception()]{std::rethrow_exception(e);};
+            }
+            {
+                std::lock_guard _(_mx);
+                _done.push(std::move(done));
+            }
+            _cv.notify_one();
+        };
+        if (_db._scan_threads > 1) {
+            //threads are started with the first job (usually nothing is scanned)
+            _pool.start(_db._scan_threads);
+            _pool.push(std::move(task));
+        } else {
+            task();
+        }
+    }
 
+    void push_batch(POriginEnv origin, std::vector<std::filesystem::path> files) {
+        push([&compiler = _compiler, origin, files]{
+            return scan_sources(compiler, origin, files);
+        }, [this, origin, files](std::vector<SourceScanner::Info> &&infos){
+            for (std::size_t i = 0; i < files.size(); ++i) {
+                auto unsatisfied = _db.register_scanned(origin, files[i], infos[i]);
+                if (_discovery) {
+                    for (const auto &[_,o]: _db._originMap) explore(*o, unsatisfied);
+                }
+                _missing = merge_references(std::move(_missing), std::move(unsatisfied));
+            }
+        });
+    }
 
-    ModuleResolver::Result mres = ModuleResolver::loadMap(origin_path);
-    return add_origin_no_discovery(mres, compiler, missing);
-}
+    ///start scanning of incomplete batches
+    void flush() {
+        auto batches = std::move(_batches);
+        _batches.clear();
+        for (auto &[origin, files]: batches) push_batch(std::move(origin), std::move(files));
+    }
 
+    void remove_satisfied() {
+        _missing.erase(std::remove_if(_missing.begin(), _missing.end(),[&](const Reference &ref){
+            return !!_db.find(ref);
+        }), _missing.end());
+    }
 
-void ModuleDatabase::run_discovery(Unsatisfied &missing_ordered, AbstractCompiler &compiler) {
-    std::queue<std::filesystem::path> to_explore;
-    std::unordered_set<std::filesystem::path> explored;
-    while (true) {
-        missing_ordered.erase(std::remove_if(missing_ordered.begin(), missing_ordered.end(),[&](const Reference &ref){
-            return !!find(ref);
-        }), missing_ordered.end());
-
-        for (auto &m: missing_ordered) {
-            for (const auto &[_,o]: _originMap) {
-                for (const auto &[pfx, paths]: o->maps) {
-                    if (ModuleResolver::match_prefix(pfx,m.name)) {
-                        for (const auto &p: paths) {
-                            if (explored.insert(p).second) {
-                                //attempt to spread searching
-                                to_explore.push(p);
-                            }
+    ///explore paths of the origin mapped to missing references
+    /**
+     * Newly unsatisfied references are checked against all origins, a newly
+     * loaded origin is checked against all unsatisfied references
+     */
+    void explore(const OriginEnv &origin, std::span<const Reference> missing) {
+        for (const auto &[pfx, paths]: origin.maps) {
+            for (const auto &m: missing) {
+                if (!ModuleResolver::match_prefix(pfx,m.name) || _db.find(m)) continue;
+                for (const auto &p: paths) {
+                    if (!_explored.insert(p).second) continue;
+                    Log::debug("Running discovery for {} . Missing: {}", [&]{return p.string();}, m.name);
+                    push([p]{
+                        return ModuleResolver::loadMap(p);
+                    }, [this](ModuleResolver::Result &&r){
+                        bool known = _db._originMap.count(r.env.config_file) != 0;
+                        auto env = add_origin(r);
+                        if (!known) {
+                            remove_satisfied();
+                            explore(*env, _missing);
                         }
-                    }
+                    });
                 }
             }
         }
+    }
+};
+
+void ModuleDatabase::set_scan_threads(unsigned int threads) {
+    _scan_threads = std::max(1U, threads);
+}
 
-        if (to_explore.empty() || missing_ordered.empty()) break;
+POriginEnv ModuleDatabase::add_origin_no_discovery(const ModuleResolver::Result &origin, AbstractCompiler &compiler, Unsatisfied &missing) {
+    ScanPipeline pipeline(*this, compiler, false);
+    auto env = pipeline.add_origin(origin);
+    missing = merge_references(std::move(missing), pipeline.run());
+    return env;
+}
 
-        auto &front = to_explore.front();
-        Log::debug("Running discovery for {} . Missing: {}", [&]{return front.string();},
-            [&]{
-                char sep = ' ';
-                std::ostringstream s;
-                for (auto &x: missing_ordered) {
-                    s << sep << " " << x.name ;
-                    sep = ',';
-                };
-                return std::move(s).str();
-            });
+POriginEnv ModuleDatabase::add_origin_no_discovery(const std::filesystem::path &origin_path, AbstractCompiler &compiler, Unsatisfied &missing) {
 
-        //adds files to database, but can extend dependencies
-         add_origin_no_discovery(front, compiler, missing_ordered);
-        to_explore.pop();
-    }
+
+    ModuleResolver::Result mres = ModuleResolver::loadMap(origin_path);
+    return add_origin_no_discovery(mres, compiler, missing);
 }
+
+
+void ModuleDatabase::run_discovery(Unsatisfied &missing_ordered, AbstractCompiler &compiler) {
+    ScanPipeline pipeline(*this, compiler, true);
+    pipeline.add_missing(std::move(missing_ordered));
+    missing_ordered = pipeline.run();
+}
+
 POriginEnv ModuleDatabase::add_origin(const ModuleResolver::Result &origin, AbstractCompiler &compiler) {
-    Unsatisfied missing;
-    auto r = add_origin_no_discovery(origin, compiler, missing);
-    run_discovery(missing, compiler);
+    //discovery starts while files of the origin are still being scanned
+    ScanPipeline pipeline(*this, compiler, true);
+    auto r = pipeline.add_origin(origin);
+    pipeline.run();
     return r;
 
 }
@@ -331,15 +572,17 @@ bool ModuleDatabase::add_file(const std::filesystem::path &source_file, Abstract
     return true;
 }
 
-ModuleDatabase::Unsatisfied ModuleDatabase::rescan_file(
-        POriginEnv origin,
-        const std::filesystem::path &source_file,
-        AbstractCompiler &compiler
-    ) {
-  
-    Log::debug("Scanning file: {}", [&]{return source_file.string();});
+SourceScanner::Info ModuleDatabase::scan_source(AbstractCompiler &compiler, const POriginEnv &origin,
+                                                const std::filesystem::path &source_file) {
+    return std::move(scan_sources(compiler, origin, {&source_file, 1}).front());
+}
 
-    std::vector<ModuleDatabase::Reference> unsatisfied;
+std::vector<SourceScanner::Info> ModuleDatabase::scan_sources(AbstractCompiler &compiler, const POriginEnv &origin,
+                                                std::span<const std::filesystem::path> source_files) {
+    static auto &cnt_files = Stats::counter("scanner.files");
+    static auto &cnt_time = Stats::counter("scanner.time", Stats::Unit::time);
+
+    for (const auto &f: source_files) Log::debug("Scanning file: {}", [&]{return f.string();});
 
     std::optional<OriginEnv> tmpenv;
     const OriginEnv *orgptr = origin.get();
@@ -347,16 +590,53 @@ ModuleDatabase::Unsatisfied ModuleDatabase::rescan_file(
         tmpenv.emplace(OriginEnv::default_env());
         orgptr = &tmpenv.value();
     }
-     
-    
+    auto start = std::chrono::steady_clock::now();
+    auto info = compiler.scan_batch(*orgptr, source_files);
+    cnt_time.add(std::chrono::steady_clock::now() - start);
+    cnt_files.add(source_files.size());
+    return info;
+}
+
+ModuleDatabase::Unsatisfied ModuleDatabase::rescan_file(
+        POriginEnv origin,
+        const std::filesystem::path &source_file,
+        AbstractCompiler &compiler
+    ) {
+    return register_scanned(origin, source_file, scan_source(compiler, origin, source_file));
+}
+
+ModuleDatabase::Unsatisfied ModuleDatabase::rescan_files(std::span<const PSource> files, AbstractCompiler &compiler) {
+    ScanPipeline pipeline(*this, compiler, false);
+    for (const auto &f: files) pipeline.add_file(f->origin, f->source_file);
+    return pipeline.run();
+}
+
+ModuleDatabase::Unsatisfied ModuleDatabase::register_scanned(
+        POriginEnv origin,
+        const std::filesystem::path &source_file,
+        const SourceScanner::Info &info
+    ) {
+
+    std::vector<ModuleDatabase::Reference> unsatisfied;
     
+    //keep recorded build time and memory, it is still good estimation
+    //keep hash of the BMI to detect, whether the new BMI is different
+    //keep stamp of the file, it was updated when the modification was detected
+    auto prev = find(source_file);
+    std::uint32_t build_time = prev?prev->build_time:0;
+    std::uint32_t peak_memory = prev?prev->peak_memory:0;
+    std::uint64_t bmi_hash = prev?prev->bmi_hash:0;
+    AbstractCompiler::FileStamp stamp = prev?prev->stamp:AbstractCompiler::FileStamp{};
     //erase file from db
     erase(source_file);
-    //run scanner
-    auto info = compiler.scan(*orgptr, source_file);
     Source srcinfo = from_scanner(source_file, info);    
     srcinfo.origin = origin;
     srcinfo.state.recompile = true;
+    srcinfo.state.changed = true;
+    srcinfo.build_time = build_time;
+    srcinfo.peak_memory = peak_memory;
+    srcinfo.bmi_hash = bmi_hash;
+    srcinfo.stamp = stamp;
     auto refs = srcinfo.references;
     //put new registration
     put(std::move(srcinfo));
@@ -447,10 +727,42 @@ void ModuleDatabase::transitive_closure(PSource from, FnRanged &&ret) const {
     ret(result.begin(), result.end());
 }
 
+static bool file_exists(const std::filesystem::path &p) {
+    static auto &cnt = Stats::counter("build.outputs_checked");
+    cnt.add();
+    return std::filesystem::exists(p);
+}
+
+//estimations used when duration of previous build is not known (in milliseconds)
+static constexpr std::size_t link_time_estimate = 1000;
+static constexpr std::size_t header_time_estimate = 1000;
+static constexpr std::size_t base_time_estimate = 100;
+static constexpr std::size_t bytes_per_ms_estimate = 64;
+
+std::size_t ModuleDatabase::estimate_build_time(const Source &src) {
+    if (src.build_time) return src.build_time;
+    //header units usually pulls a lot of other headers, size of the header says nothing
+    if (is_header_module(src.type)) return header_time_estimate;
+    static auto &stat_cnt = Stats::counter("build.size_estimates");
+    stat_cnt.add();
+    std::error_code ec;
+    auto sz = std::filesystem::file_size(src.source_file, ec);
+    if (ec != std::error_code{}) return base_time_estimate;
+    return base_time_estimate + static_cast<std::size_t>(sz / bytes_per_ms_estimate);
+}
+
+//estimation of peak memory used when it was not recorded (in bytes)
+static constexpr std::size_t memory_estimate = std::size_t(1) << 30;
+
+std::size_t ModuleDatabase::estimate_memory(const Source &src) {
+    if (src.peak_memory) return static_cast<std::size_t>(src.peak_memory) * 1024;
+    return memory_estimate;
+}
+
 BuildPlan<ModuleDatabase::CompileAction> ModuleDatabase::create_build_plan(
     AbstractCompiler &compiler, const OriginEnv &env, 
     std::span<const CompileTarget> targets,
-    bool recompile, bool build_library) const
+    bool recompile, bool build_library, ArtifactCache *cache, RemoteExecutor *remote) const
 {
     auto getenv = [&](const PSource &src) -> const OriginEnv & {
         return src->origin?*src->origin:env;
@@ -486,8 +798,9 @@ BuildPlan<ModuleDatabase::CompileAction> ModuleDatabase::create_build_plan(
                 if (generates_object(ss->type)) {
                     lnk.first.push_back(ss);
                     //test for need recompile, if need, create targets
-                    if (recompile || ss->state.recompile || ss->object_path.empty() || !std::filesystem::exists(ss->object_path)) {
-                        auto ref = plan.create_target({*this, compiler, getenv(ss), ss},ncompiled(ss));
+                    if (recompile || ss->state.recompile || ss->object_path.empty() || !file_exists(ss->object_path)) {
+                        auto ref = plan.create_target({*this, compiler, getenv(ss), ss, recompile, cache, remote},ncompiled(ss), 
+                                            estimate_build_time(*ss), estimate_memory(*ss));
                         target_ids.emplace(ss, ref);
                         //add to process this target
                         to_process.push(ss);
@@ -495,7 +808,8 @@ BuildPlan<ModuleDatabase::CompileAction> ModuleDatabase::create_build_plan(
                 }
             }
             //add link step target
-            auto ref = plan.create_target({*this, compiler, getenv(sinfo), std::move(lnk)},nlinked(t));
+            auto ref = plan.create_target({*this, compiler, getenv(sinfo), std::move(lnk)},nlinked(t), 
+                                            link_time_estimate, memory_estimate);
             //add dependencies for this target
             for (const PSource &ss: tmp) {
                 auto iter = target_ids.find(ss);
@@ -525,9 +839,10 @@ BuildPlan<ModuleDatabase::CompileAction> ModuleDatabase::create_build_plan(
                     //and file marked as recompile or has empty bmi path or the file doesn't exists
                     if (generates_bmi(s->type) && (recompile || s->state.recompile 
                             || s->bmi_path.empty() 
-                            || !std::filesystem::exists(s->bmi_path))) {
+                            || !file_exists(s->bmi_path))) {
                         //create target
-                        auto ref = plan.create_target({*this, compiler, getenv(s), s},ncompiled(s));                    
+                        auto ref = plan.create_target({*this, compiler, getenv(s), s, recompile, cache, remote},ncompiled(s), 
+                                            estimate_build_time(*s), estimate_memory(*s));
                         target_ids.emplace(s,ref);
                         to_process.push(s);
                         //add to dependency
@@ -557,37 +872,95 @@ auto ModuleDatabase::CompileAction::get_references(const PSource &f) const {
     return references;
 }
 
+std::uint64_t ModuleDatabase::CompileAction::get_input_hash(const PSource &f) const {
+    //BMIs are collected in unspecified order, so hashes are combined by addition
+    std::uint64_t out = 0;
+    bool known = true;
+    db.collect_bmi_references(f, [&](auto beg, auto end){
+        for (const auto &s: std::ranges::subrange(beg, end)) {
+            if (!s->bmi_hash) known = false;
+            out += hash_combine(Reference{s->type, s->name}.hash(), static_cast<std::size_t>(s->bmi_hash));
+        }
+    }, compiler.transitive_headers());
+    if (!known) return 0;
+    return out?out:1;
+}
+
+bool ModuleDatabase::CompileAction::can_skip(const PSource &f, std::uint64_t input_hash) const {
+    if (force || f->state.changed || !input_hash || f->input_hash != input_hash) return false;
+    if (generates_bmi(f->type) && (!f->bmi_hash || f->bmi_path.empty() || !file_exists(f->bmi_path))) return false;
+    if (generates_object(f->type) && (f->object_path.empty() || !file_exists(f->object_path))) return false;
+    return true;
+}
+
+ArtifactCache::Key ModuleDatabase::CompileAction::get_cache_key(const PSource &f, 
+        std::span<const SourceDef> references, AbstractCompiler::CompileResult &outputs) const {
+    //header units are not cached, their textual includes are not known
+    if (!cache || is_header_module(f->type)) return 0;
+    SourceDef src{f->type, f->name, f->source_file};
+    if (!compiler.get_outputs(env, src, references, outputs)) return 0;
+    ArtifactCache::KeyBuilder key(*cache);
+    key.add(static_cast<std::uint64_t>(f->type));
+    key.add(f->name);
+    if (!key.add_file(f->source_file)) return 0;
+    for (const auto &i: f->includes) {
+        if (!key.add_file(i)) return 0;
+    }
+    //content of imported BMIs (sorted, they are collected in unspecified order)
+    std::vector<std::uint64_t> bmis;
+    db.collect_bmi_references(f, [&](auto beg, auto end){
+        for (const auto &s: std::ranges::subrange(beg, end)) bmis.push_back(s->bmi_hash);
+    }, compiler.transitive_headers());
+    std::sort(bmis.begin(), bmis.end());
+    if (!bmis.empty() && bmis.front() == 0) return 0;
+    for (auto h: bmis) key.add(h);
+    compiler.generate_compile_commands([&](const std::filesystem::path &directory,
+                        const std::filesystem::path &,
+                        const std::filesystem::path &,
+                        const std::filesystem::path &program,
+                        std::vector<ArgumentString> &&arguments){
+        key.add_command(directory, program, arguments);
+    }, env, src, references);
+    return key.value();
+}
+
+///Finish the action without compilation - imported BMIs didn't change
+static void cutoff_compile(const ModuleDatabase &db, const ModuleDatabase::PSource &f) {
+    static auto &cnt = Stats::counter("build.cutoff");
+    cnt.add();
+    Log::debug("{} - imported BMIs didn't change - compilation skipped", [&]{return f->source_file.string();});
+    f->state.recompile = false;
+    db.set_dirty();
+}
+
 bool ModuleDatabase::CompileAction::operator()() const noexcept 
 {
     try {
         if (std::holds_alternative<PSource>(step)) {
             const PSource &f = std::get<PSource>(step);
+            auto input_hash = get_input_hash(f);
+            if (can_skip(f, input_hash)) {
+                cutoff_compile(db, f);
+                return true;
+            }
+            auto references = get_references(f);
             AbstractCompiler::CompileResult result;
-            int res = compiler.compile(env, {f->type, f->name, f->source_file}, get_references(f), result);
+            auto key = get_cache_key(f, references, result);
+            if (key && cache->restore(key, result)) {
+                Log::debug("{} - restored from the artifact cache", [&]{return f->source_file.string();});
+                update_compiled(f, result, {}, input_hash);
+                return true;
+            }
+            result = {};
+            auto start = std::chrono::steady_clock::now();
+            int res = compiler.compile(env, {f->type, f->name, f->source_file}, references, result);
             if (res == 0) {
-                f->bmi_path = result.interface;
-                f->object_path = result.object;
-                f->state.recompile = false;
-                db.set_dirty();
+                update_compiled(f, result, std::chrono::steady_clock::now() - start, input_hash);
+                if (key) cache->store(key, result);
             }
             return res == 0;
         } else {
-            const LinkStep  &lnk = std::get<LinkStep>(step);
-            std::unordered_set<std::filesystem::path> objs;
-            objs.reserve(lnk.first.size());
-            for (auto &f: lnk.first) {
-                if (!objs.insert(f->object_path).second) {
-                    for (auto &g: lnk.first) if (g->object_path == f->object_path) {
-                            Log::warning("Duplicate object file: {} for {} origin {}", 
-                                g->object_path.string(), 
-                                g->source_file.string(), 
-                                g->origin->config_file.string());
-                    }
-                }
-            }
-            auto objs_vec = std::vector(objs.begin(), objs.end());
-            int res = compiler.link(objs_vec, lnk.second);
-            return res == 0;
+            return link(std::get<LinkStep>(step)) == 0;
         }
     } catch (std::exception &e) {
         Log::error("EXCEPTION: {}", e.what());
@@ -596,6 +969,145 @@ bool ModuleDatabase::CompileAction::operator()() const noexcept
 }
 
 
+int ModuleDatabase::CompileAction::link(const LinkStep &lnk) const {
+    std::unordered_set<std::filesystem::path> objs;
+    objs.reserve(lnk.first.size());
+    for (auto &f: lnk.first) {
+        if (!objs.insert(f->object_path).second) {
+            for (auto &g: lnk.first) if (g->object_path == f->object_path) {
+                    Log::warning("Duplicate object file: {} for {} origin {}", 
+                        g->object_path.string(), 
+                        g->source_file.string(), 
+                        g->origin->config_file.string());
+            }
+        }
+    }
+    auto objs_vec = std::vector(objs.begin(), objs.end());
+    return compiler.link(objs_vec, lnk.second);
+}
+
+static void trace_compile(const ModuleDatabase::Source &src, unsigned int lane, 
+                std::chrono::steady_clock::time_point start, int status, 
+                const AbstractCompiler::CompileResult &result) {
+    Trace::record(src.source_file.filename().string(), "compile", lane, start, std::chrono::steady_clock::now(), {
+        {"source", Json(src.source_file.u8string())},
+        {"module", Json(src.name)},
+        {"interface", Json(result.interface.u8string())},
+        {"object", Json(result.object.u8string())},
+        {"exit_code", Json(static_cast<double>(status))}
+    });
+    for (const auto &ph: result.phases) {
+        Trace::record(ph.name, "phase", lane, ph.start, ph.end, {
+            {"exit_code", Json(static_cast<double>(ph.status))}
+        });
+    }
+}
+
+void ModuleDatabase::CompileAction::run_async(unsigned int lane, std::function<void(bool)> cb) const noexcept {
+    auto start = std::chrono::steady_clock::now();
+    if (!std::holds_alternative<PSource>(step)) {
+        const LinkStep &lnk = std::get<LinkStep>(step);
+        int res = -1;
+        try {
+            res = link(lnk);
+        } catch (std::exception &e) {
+            Log::error("EXCEPTION: {}", e.what());
+        }
+        if (Trace::is_enabled()) {
+            Trace::record(lnk.second.filename().string(), "link", lane, start, std::chrono::steady_clock::now(), {
+                {"output", Json(lnk.second.u8string())},
+                {"exit_code", Json(static_cast<double>(res))}
+            });
+        }
+        cb(res == 0);
+        return;
+    }
+    try {
+        const PSource &f = std::get<PSource>(step);
+        auto input_hash = get_input_hash(f);
+        if (can_skip(f, input_hash)) {
+            cutoff_compile(db, f);
+            cb(true);
+            return;
+        }
+        auto references = get_references(f);
+        AbstractCompiler::CompileResult outputs;
+        auto key = get_cache_key(f, references, outputs);
+        if (key && cache->restore(key, outputs)) {
+            Log::debug("{} - restored from the artifact cache", [&]{return f->source_file.string();});
+            update_compiled(f, outputs, {}, input_hash);
+            if (Trace::is_enabled()) {
+                Trace::record(f->source_file.filename().string(), "cache", lane, start, std::chrono::steady_clock::now(), {
+                    {"source", Json(f->source_file.u8string())}
+                });
+            }
+            cb(true);
+            return;
+        }
+        AbstractCompiler::CompileCallback done = 
+            [this, f, start, lane, cb, input_hash, key](int res, const AbstractCompiler::CompileResult &result) {
+                if (res == 0) {
+                    update_compiled(f, result, std::chrono::steady_clock::now() - start, input_hash);
+                    if (key) cache->store(key, result);
+                }
+                if (Trace::is_enabled()) trace_compile(*f, lane, start, res, result);
+                cb(res == 0);
+        };
+        if (remote && run_remote(f, references, done)) return;
+        compiler.compile_async(env, {f->type, f->name, f->source_file}, references, std::move(done));
+    } catch (std::exception &e) {
+        Log::error("EXCEPTION: {}", e.what());
+        cb(false);
+    }
+}
+
+bool ModuleDatabase::CompileAction::run_remote(const PSource &f, std::span<const SourceDef> references,
+                        AbstractCompiler::CompileCallback &cb) const {
+    RemoteExecutor::Job job;
+    if (!compiler.get_commands(env, {f->type, f->name, f->source_file}, references, job.invocation, job.outputs)) {
+        return false;
+    }
+    job.inputs.push_back(f->source_file);
+    job.inputs.insert(job.inputs.end(), f->includes.begin(), f->includes.end());
+    for (const auto &r: references) job.inputs.push_back(r.path);
+    //on failure, the callback is not consumed
+    auto remote_cb = cb;
+    //the worker can disconnect before the job is done - then it is compiled locally
+    auto local = [this, f, refs = std::vector<SourceDef>(references.begin(), references.end()), cb]() mutable {
+        compiler.compile_async(env, {f->type, f->name, f->source_file}, refs, std::move(cb));
+    };
+    return remote->execute(std::move(job), std::move(remote_cb), std::move(local));
+}
+
+void ModuleDatabase::CompileAction::update_compiled(const PSource &f, 
+        const AbstractCompiler::CompileResult &result, 
+        std::chrono::steady_clock::duration duration, std::uint64_t input_hash) const {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+    f->bmi_path = result.interface;
+    f->object_path = result.object;
+    f->state.recompile = false;
+    f->state.changed = false;
+    f->input_hash = input_hash;
+    if (!result.interface.empty()) {
+        static auto &cnt = Stats::counter("build.bmi_hashed", Stats::Unit::bytes);
+        std::error_code ec;
+        cnt.add(std::filesystem::file_size(result.interface, ec));
+        auto h = hash_file(result.interface);
+        if (f->bmi_hash && h == f->bmi_hash) {
+            Log::debug("{} - BMI didn't change", [&]{return f->source_file.string();});
+        }
+        f->bmi_hash = h;
+    }
+    //duration is zero, when the result was restored from the artifact cache
+    if (duration != std::chrono::steady_clock::duration::zero()) {
+        f->build_time = static_cast<std::uint32_t>(std::max<std::chrono::milliseconds::rep>(1, ms.count()));
+    }
+    if (result.peak_memory) {
+        f->peak_memory = static_cast<std::uint32_t>(std::min<std::size_t>(result.peak_memory / 1024, 
+                                            std::numeric_limits<std::uint32_t>::max()));
+    }
+    db.set_dirty();
+}
 
 
 void ModuleDatabase::CompileAction::generate_compile_commands(AbstractCompiler::CompileCommandCB cb) const
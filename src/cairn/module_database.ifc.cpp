@@ -10,6 +10,8 @@ import cairn.build_plan;
 import cairn.compile_target;
 import cairn.abstract_compiler;
 import cairn.compile_commands;
+import cairn.artifact_cache;
+import cairn.remote.executor;
 
 import <atomic>;
 import <chrono>;
@@ -28,7 +30,7 @@ export class ModuleDatabase {
 public:
 
     static constexpr std::uint32_t file_magic = 0x0042444D;
-    static constexpr std::uint32_t file_version_nr = 1;
+    static constexpr std::uint32_t file_version_nr = 6;
 
     struct Reference {
         ModuleType type;
@@ -52,6 +54,7 @@ public:
     struct State {
         bool recompile = false;         ///<this file needs to be recompiled
         bool rescan = false;            ///<this file must be rescaned        )
+        bool changed = false;           ///<the file itself changed (recompile can't be cut off)
     };
 
 
@@ -63,16 +66,23 @@ public:
         POriginEnv origin = {};
         std::vector<Reference> references = {};
         std::vector<Reference> exported = {};
+        std::vector<std::filesystem::path> includes = {};   ///<files included textually (for the artifact cache)
         std::filesystem::path object_path = {};
         std::filesystem::path bmi_path = {};
         State state = {};
+        std::uint32_t build_time = 0;   ///<duration of last compilation in milliseconds (0 - unknown)
+        std::uint32_t peak_memory = 0;  ///<peak memory of last compilation in kilobytes (0 - unknown)
+        std::uint64_t bmi_hash = 0;     ///<hash of content of the BMI (0 - unknown)
+        std::uint64_t input_hash = 0;   ///<combined hash of BMIs used by last compilation (0 - unknown)
+        AbstractCompiler::FileStamp stamp = {}; ///<size, last write time and hash of the content
 
         template<typename Me, typename Arch>
         static void serialize(Me &me, Arch &arch) {
             arch(
                 me.source_file,me.type,me.name,
-                me.origin,me.references,me.exported,
-                me.object_path,me.bmi_path, me.state.recompile
+                me.origin,me.references,me.exported,me.includes,
+                me.object_path,me.bmi_path, me.state.recompile, me.state.changed,
+                me.build_time, me.peak_memory, me.bmi_hash, me.input_hash, me.stamp
             );
         }
     };
@@ -110,9 +120,17 @@ public:
     */
     std::vector<PSource> find_multi(Reference ref) const;
     bool is_dirty() const;
+    ///returns count of source files in the database
+    std::size_t size() const {return _fileIndex.size();}
     void clear_dirty() const;
     void set_dirty() const;
 
+    ///Set count of threads used to scan sources
+    /**
+     * @param threads count of threads. 1 - sources are scanned by the calling thread
+     */
+    void set_scan_threads(unsigned int threads);
+
 
     ///checks whether files are modified and updates their states accordingly
     /** It also populates recompile state to ensure correct dependency */
@@ -151,6 +169,14 @@ public:
     Unsatisfied rescan_file(POriginEnv origin, const std::filesystem::path &source_file,
             AbstractCompiler &compiler);
 
+    ///Rescan multiple files (in parallel)
+    /**
+     * @param files files to rescan
+     * @param compiler compiler to use
+     * @return unsatisfied references (ordered)
+     */
+    Unsatisfied rescan_files(std::span<const PSource> files, AbstractCompiler &compiler);
+
 
     
     struct CompileAction {
@@ -161,25 +187,117 @@ public:
         using CompileStep = PSource;
         using LinkStep = std::pair<std::vector<PSource>, std::filesystem::path>; //objects and output
         std::variant<CompileStep, LinkStep> step;
+        ///compile even if imported BMIs didn't change (full rebuild)
+        bool force = false;
+        ///artifact cache (optional)
+        ArtifactCache *cache = nullptr;
+        ///remote executor (optional)
+        RemoteExecutor *remote = nullptr;
 
         //compile action
         bool operator()() const noexcept;        
+        ///start action asynchronously, callback receives result of the action
+        /** Link step is executed synchronously 
+         * @param lane lane of the job (for tracing)
+         * @param cb callback
+         */
+        void run_async(unsigned int lane, std::function<void(bool)> cb) const noexcept;
+        ///perform link step, returns exit code of the linker
+        int link(const LinkStep &lnk) const;
         void generate_compile_commands(AbstractCompiler::CompileCommandCB cb) const;
         auto get_references(const PSource &f) const;
+        ///combine hashes of all BMIs required to compile the source
+        /** @return combined hash, or zero, if hash of any BMI is not known */
+        std::uint64_t get_input_hash(const PSource &f) const;
+        ///test whether compilation can be skipped (early cutoff)
+        /**
+         * The compilation is skipped, if the source itself didn't change, its
+         * products exist and all imported BMIs have the same content as during
+         * the last compilation
+         * @param f source
+         * @param input_hash current hash of imported BMIs
+         */
+        bool can_skip(const PSource &f, std::uint64_t input_hash) const;
+        ///compute key of the compilation for the artifact cache
+        /**
+         * @param f source
+         * @param references required modules
+         * @param outputs receives expected outputs of the compilation
+         * @return key, or zero, if the compilation cannot be cached
+         */
+        ArtifactCache::Key get_cache_key(const PSource &f, std::span<const SourceDef> references, 
+                        AbstractCompiler::CompileResult &outputs) const;
+        ///try to execute the compilation on a remote worker
+        /**
+         * @param f source
+         * @param references required modules
+         * @param cb callback called when compilation is done
+         * @retval true compilation has been sent
+         * @retval false compilation must be executed locally
+         */
+        bool run_remote(const PSource &f, std::span<const SourceDef> references,
+                        AbstractCompiler::CompileCallback &cb) const;
+        void update_compiled(const PSource &f, const AbstractCompiler::CompileResult &result, 
+                        std::chrono::steady_clock::duration duration, std::uint64_t input_hash) const;
     };
 
+    ///Create build plan
+    /**
+     * @param compiler compiler
+     * @param env default environment
+     * @param targets targets to build
+     * @param recompile recompile all related files
+     * @param build_library build library (not supported yet)
+     * @param cache optional artifact cache used by compile actions
+     * @param remote optional remote executor used by compile actions
+     * @return build plan
+     */
     BuildPlan<CompileAction> create_build_plan(AbstractCompiler &compiler, 
                 const OriginEnv &env,
                 std::span<const CompileTarget> targets, 
-                bool recompile, bool build_library) const;
+                bool recompile, bool build_library, ArtifactCache *cache = nullptr,
+                RemoteExecutor *remote = nullptr) const;
 
 
+    ///Estimate duration of compilation of the source in milliseconds
+    /**
+     * Uses duration recorded during previous build. If not available, it
+     * estimates duration from size of the source file
+     */
+    static std::size_t estimate_build_time(const Source &src);
+
+    ///Estimate peak memory of compilation of the source in bytes
+    /**
+     * Uses peak memory recorded during previous build. If not available, it
+     * returns conservative default
+     */
+    static std::size_t estimate_memory(const Source &src);
+
     template<typename VectorOfSourceDef>
     static void extract_module_mapping(const BuildPlan<CompileAction> &a, VectorOfSourceDef &out);
 
     void check_for_modifications(AbstractCompiler &compiler);
     void check_for_recompile();
 
+    ///Update database for reported changes (watch mode)
+    /**
+     * Only reported files are checked. Modified sources and sources including
+     * modified headers are rescanned, removed sources are erased and changed
+     * origins are reloaded
+     *
+     * @param changed list of changed paths (sources, headers, origins)
+     * @param compiler compiler
+     */
+    void apply_changes(std::span<const std::filesystem::path> changed, AbstractCompiler &compiler);
+
+    ///Collect paths which affect the database (watch mode)
+    /**
+     * @param files receives sources, textually included headers and YAML origins
+     * @param directories receives directory origins
+     */
+    void collect_tracked(std::vector<std::filesystem::path> &files,
+                         std::vector<std::filesystem::path> &directories) const;
+
     
 
     bool check_database_version(const std::filesystem::path &compiler, std::span<const ArgumentString> arguments);
@@ -221,6 +339,20 @@ protected:
     std::chrono::system_clock::time_point _modify_time; //time when database was modified
     std::chrono::system_clock::time_point _import_time = std::chrono::system_clock::now();   //time when database was imported
     mutable std::atomic<bool> _modified;     //database has been modified
+    unsigned int _scan_threads = 1;         //count of threads used to scan sources
+
+    class ScanPipeline;
+
+    ///run scanner on the file (thread safe)
+    static SourceScanner::Info scan_source(AbstractCompiler &compiler, const POriginEnv &origin,
+                                           const std::filesystem::path &source_file);
+    ///run scanner on files of the same origin (thread safe)
+    static std::vector<SourceScanner::Info> scan_sources(AbstractCompiler &compiler, const POriginEnv &origin,
+                                           std::span<const std::filesystem::path> source_files);
+    ///replace the file in the database by result of the scanner
+    /** @return unsatisfied references (ordered) */
+    Unsatisfied register_scanned(POriginEnv origin, const std::filesystem::path &source_file,
+                                 const SourceScanner::Info &info);
 
     ///create transitive clousure from source file (source is excluded)
     /**
@@ -238,6 +370,8 @@ protected:
 
 
     static Unsatisfied merge_references(Unsatisfied a1, Unsatisfied a2);
+    ///add references which are not satisfied by the database (ordered)
+    void collect_missing(Unsatisfied &missing) const;
   
 
 };
\ No newline at end of file
@@ -15,6 +15,7 @@ import <format>;
 import <functional>;
 import cairn.utils.hash;
 import cairn.utils.log;
+import cairn.utils.stats;
 import cairn.utils.utf8;
 
 
@@ -165,6 +166,8 @@ ModuleResolver::Result ModuleResolver::loadMap(const std::filesystem::path &dire
 }
 
 bool ModuleResolver::detect_change(const OriginEnv &env, std::filesystem::file_time_type treshold) {
+    static auto &cnt = Stats::counter("resolver.config_checks");
+    cnt.add();
     std::error_code ec;    
     auto wrtm = std::filesystem::last_write_time(env.config_file, ec);
     if (ec != std::error_code{}) {
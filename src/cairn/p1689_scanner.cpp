@@ -0,0 +1,444 @@
+export module cairn.p1689_scanner;
+
+import cairn.source_scanner;
+import cairn.module_type;
+import cairn.utils.arguments;
+import cairn.utils.process;
+import cairn.utils.simple_json;
+import cairn.utils.utf8;
+import cairn.utils.log;
+import cairn.utils.stats;
+
+import <algorithm>;
+import <atomic>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iterator>;
+import <limits>;
+import <optional>;
+import <span>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Scanning by the compiler's own dependency scanner (P1689 format)
+//clang - clang-scan-deps -format=p1689 over a compilation database (many files at once)
+//gcc   - -fdeps-format=p1689r5 (a file per invocation)
+
+
+inline const Json &p1689_field(const Json &obj, const std::string &name) {
+    static const Json null_json;
+    const auto &o = obj.as_object();
+    auto iter = o.find(name);
+    return iter == o.end()?null_json:iter->second;
+}
+
+inline std::filesystem::path p1689_path(const Json &j) {
+    return std::filesystem::path(u8_from_string(j.as_string()));
+}
+
+inline std::string read_text_file(const std::filesystem::path &p) {
+    std::ifstream f(p, std::ios::in|std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+inline Json read_json(std::istream &in) {
+    return Json::parse([&]()->std::optional<char> {
+        int c = in.get();
+        if (c == -1) return std::nullopt;
+        else return static_cast<char>(c);
+    });
+}
+
+///Converts a rule of P1689 output to the result of the scanner
+export inline SourceScanner::Info p1689_rule_to_info(const Json &rule) {
+    SourceScanner::Info nfo;
+    const auto &provides = p1689_field(rule, "provides").as_array();
+    if (!provides.empty()) {
+        nfo.name = p1689_field(provides.front(), "logical-name").as_string();
+        nfo.type = nfo.name.find(':') != nfo.name.npos?ModuleType::partition:ModuleType::interface;
+    }
+    for (const auto &r: p1689_field(rule, "requires").as_array()) {
+        std::string name = p1689_field(r, "logical-name").as_string();
+        const auto &lookup = p1689_field(r, "lookup-method").as_string();
+        ModuleType t;
+        if (lookup == "include-angle" || lookup == "include-quote") {
+            t = lookup == "include-angle"?ModuleType::system_header:ModuleType::user_header;
+            if (name.size() >= 2 && (name.front() == '<' || name.front() == '"')) {
+                name = name.substr(1, name.size() - 2);
+            }
+        } else {
+            t = name.find(':') != name.npos?ModuleType::partition:ModuleType::interface;
+        }
+        nfo.required.push_back({t, std::move(name)});
+    }
+    //P1689 doesn't tell, which imports are exported. All named modules imported by an interface
+    //are treated as exported, so the compiler can get more BMIs than needed, but never less
+    //(see p1689_detect_exports)
+    if (nfo.type == ModuleType::interface || nfo.type == ModuleType::partition) {
+        for (const auto &r: nfo.required) {
+            if (!is_header_module(r.type)) nfo.exported.push_back(r);
+        }
+    }
+    return nfo;
+}
+
+///Recognizes implementation unit
+/**
+ * P1689 reports the primary module of an implementation unit as an ordinary
+ * import. The unit is recognized by the declaration "module name;" written
+ * on its own line, where the name is one of required modules
+ *
+ * @param file source file
+ * @param nfo result of scan, updated when the declaration is found
+ */
+export inline void p1689_detect_implementation(const std::filesystem::path &file, SourceScanner::Info &nfo) {
+    if (nfo.type != ModuleType::source || nfo.required.empty()) return;
+    std::ifstream f(file);
+    std::string ln;
+    auto skip_ws = [](std::string_view w) {
+        while (!w.empty() && std::isspace(static_cast<unsigned char>(w.front()))) w = w.substr(1);
+        return w;
+    };
+    while (std::getline(f, ln)) {
+        auto w = skip_ws(ln);
+        if (!w.starts_with("module")) continue;
+        w = w.substr(6);
+        if (w.empty() || !std::isspace(static_cast<unsigned char>(w.front()))) continue;  //module;
+        w = skip_ws(w);
+        auto name = w.substr(0, std::min(w.find_first_of("; \t\r"), w.size()));
+        for (const auto &r: nfo.required) {
+            if (r.type == ModuleType::interface && r.name == name) {
+                nfo.name = r.name;
+                nfo.type = ModuleType::implementation;
+                break;
+            }
+        }
+        return;
+    }
+}
+
+///Recognizes exported imports of an interface
+/**
+ * P1689 doesn't tell, which imports are exported, p1689_rule_to_info treats all of
+ * them as exported. They are recovered from declarations "export import name;"
+ * written on their own line. When the source contains anything else exported
+ * by an import-like construct (an export block), the conservative result is kept
+ *
+ * @param file source file
+ * @param nfo result of scan, exported modules are updated
+ */
+export inline void p1689_detect_exports(const std::filesystem::path &file, SourceScanner::Info &nfo) {
+    static auto &guessed = Stats::counter("scanner.p1689_exports_guessed");
+    if (nfo.exported.empty()) return;
+    std::ifstream f(file);
+    if (!f) {
+        guessed.add();
+        return;
+    }
+    auto skip_ws = [](std::string_view w) {
+        while (!w.empty() && std::isspace(static_cast<unsigned char>(w.front()))) w = w.substr(1);
+        return w;
+    };
+    auto primary = std::string_view(nfo.name).substr(0, std::min(nfo.name.find(':'), nfo.name.size()));
+    std::vector<std::string> exported;
+    std::string ln;
+    while (std::getline(f, ln)) {
+        auto w = skip_ws(ln);
+        if (!w.starts_with("export")) continue;
+        w = skip_ws(w.substr(6));
+        if (w.starts_with("{")) {
+            //imports can be exported by the block
+            guessed.add();
+            return;
+        }
+        if (!w.starts_with("import")) continue;
+        w = skip_ws(w.substr(6));
+        std::string name;
+        for (char c: w.substr(0, std::min(w.find(';'), w.size()))) {
+            if (!std::isspace(static_cast<unsigned char>(c))) name.push_back(c);
+        }
+        if (name.starts_with(":")) name = std::string(primary).append(name);
+        exported.push_back(std::move(name));
+    }
+    std::erase_if(nfo.exported, [&](const SourceScanner::Reference &r){
+        return std::find(exported.begin(), exported.end(), r.name) == exported.end();
+    });
+}
+
+///Rule of a makefile generated by -MD
+export struct DepfileRule {
+    std::filesystem::path target;
+    std::vector<std::filesystem::path> dependencies;
+};
+
+///Parses rules of a makefile generated by -MD or by clang-scan-deps -format=make
+/**
+ * @param text content of the makefile
+ * @param workdir directory of the compilation (for relative paths)
+ * @return rules in order of the file
+ */
+export inline std::vector<DepfileRule> parse_depfile_rules(std::string_view text, const std::filesystem::path &workdir) {
+    std::vector<DepfileRule> out;
+    DepfileRule rule;
+    bool in_deps = false;
+    std::string cur;
+    auto flush = [&]{
+        if (cur.empty()) return;
+        auto p = (workdir/std::filesystem::path(u8_from_string(cur))).lexically_normal();
+        if (in_deps) rule.dependencies.push_back(std::move(p));
+        else rule.target = std::move(p);
+        cur.clear();
+    };
+    auto finish = [&]{
+        flush();
+        if (in_deps) out.push_back(std::move(rule));
+        rule = {};
+        in_deps = false;
+    };
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        char c = text[pos++];
+        if (c == '\\' && pos < text.size()) {
+            char d = text[pos];
+            if (d == '\n' || d == '\r') {
+                flush();
+                while (pos < text.size() && (text[pos] == '\n' || text[pos] == '\r')) ++pos;
+            } else if (d == ' ' || d == '#') {
+                cur.push_back(d);
+                ++pos;
+            } else {
+                cur.push_back(c);
+            }
+        } else if (c == '$' && pos < text.size() && text[pos] == '$') {
+            cur.push_back(c);
+            ++pos;
+        } else if (c == ':' && !in_deps && (pos == text.size() || std::isspace(static_cast<unsigned char>(text[pos])))) {
+            //end of target, a colon of drive letter is not followed by a white character
+            flush();
+            in_deps = true;
+        } else if (c == '\n') {
+            finish();
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+            flush();
+        } else {
+            cur.push_back(c);
+        }
+    }
+    finish();
+    return out;
+}
+
+///Parses dependencies of the first rule of a makefile generated by -MD
+/**
+ * @param text content of the makefile
+ * @param workdir directory of the compilation (for relative paths)
+ * @param source the source file, which is not reported
+ * @return included files
+ */
+export inline std::vector<std::filesystem::path> parse_depfile(std::string_view text,
+                        const std::filesystem::path &workdir, const std::filesystem::path &source) {
+    auto rules = parse_depfile_rules(text, workdir);
+    if (rules.empty()) return {};
+    auto out = std::move(rules.front().dependencies);
+    std::erase(out, source.lexically_normal());
+    return out;
+}
+
+inline void write_compilation_database(const std::filesystem::path &path, const Json::Array &cdb) {
+    std::ofstream f(path, std::ios::out|std::ios::trunc);
+    Json(cdb).serialize([&](char c){f.put(c);});
+}
+
+///Scans multiple files by single invocation of clang-scan-deps
+/**
+ * Older versions of clang-scan-deps ignore -MD -MF of commands of the compilation
+ * database in P1689 mode, so included files are not known. Files without the
+ * depfile are scanned again with -format=make
+ *
+ * @param scanner path to clang-scan-deps
+ * @param compiler path to the compiler
+ * @param args arguments of compilation
+ * @param workdir working directory of compilation
+ * @param files files to scan
+ * @param tmpdir directory for temporary files
+ * @return result for each file, nullopt when the file was not scanned
+ */
+export inline std::vector<std::optional<SourceScanner::Info> > run_clang_scan_deps(
+        const std::filesystem::path &scanner,
+        const std::filesystem::path &compiler,
+        std::span<const ArgumentString> args,
+        const std::filesystem::path &workdir,
+        std::span<const std::filesystem::path> files,
+        const std::filesystem::path &tmpdir) {
+
+    static auto &invocations = Stats::counter("scanner.p1689_invocations");
+    static auto &make_passes = Stats::counter("scanner.p1689_make_passes");
+    static std::atomic<unsigned int> batch_counter = 0;
+    auto batch = batch_counter++;
+
+    std::vector<std::optional<SourceScanner::Info> > result(files.size());
+    std::vector<std::filesystem::path> outputs;
+    std::vector<std::filesystem::path> depfiles;
+    Json::Array cdb;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        auto base = tmpdir/std::format("batch{}_{}", batch, i);
+        auto obj = base;
+        obj += ".o";
+        auto dep = base;
+        dep += ".d";
+        //batches are numbered from zero in every run, don't read a depfile of a previous run
+        std::error_code ec;
+        std::filesystem::remove(dep, ec);
+        std::vector<ArgumentString> cmd;
+        cmd.push_back(path_arg(compiler));
+        cmd.insert(cmd.end(), args.begin(), args.end());
+        append_arguments(cmd, {"-x","c++","{}","-c","-o","{}","-MD","-MF","{}"},
+                        {path_arg(files[i]), path_arg(obj), path_arg(dep)});
+        Json::Array jargs;
+        for (const auto &a: cmd) jargs.emplace_back(a);
+        cdb.push_back({
+            {"directory", workdir.u8string()},
+            {"file", files[i].u8string()},
+            {"arguments", std::move(jargs)},
+            {"output", obj.u8string()}
+        });
+        outputs.push_back((workdir/obj).lexically_normal());
+        depfiles.push_back(std::move(dep));
+    }
+    auto cdb_path = tmpdir/std::format("batch{}.json", batch);
+    write_compilation_database(cdb_path, cdb);
+
+    std::vector<ArgumentString> scan_args;
+    append_arguments(scan_args, {"-format=p1689","-compilation-database={}"}, {path_arg(cdb_path)});
+    invocations.add();
+    Json rules;
+    {
+        auto p = Process::spawn(scanner, workdir, scan_args, Process::output);
+        try {
+            rules = p1689_field(read_json(*p.stdout_stream), "rules");
+        } catch (const Json::ParseError &e) {
+            Log::error("Failed to parse output of {}: {}", [&]{return scanner.string();}, e.what());
+            p.stdout_stream->ignore(std::numeric_limits<std::streamsize>::max());
+        }
+        if (p.waitpid_status() != 0) {
+            Log::warning("{} reported errors", [&]{return scanner.string();});
+        }
+    }
+
+    std::vector<std::size_t> without_depfile;
+    for (const auto &r: rules.as_array()) {
+        auto out = (workdir/p1689_path(p1689_field(r, "primary-output"))).lexically_normal();
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            if (outputs[i] != out) continue;
+            auto nfo = p1689_rule_to_info(r);
+            p1689_detect_implementation(files[i], nfo);
+            p1689_detect_exports(files[i], nfo);
+            //the depfile always contains at least the source, empty depfile is not valid
+            auto dep_rules = parse_depfile_rules(read_text_file(depfiles[i]), workdir);
+            if (dep_rules.empty()) {
+                without_depfile.push_back(i);
+            } else {
+                nfo.includes = std::move(dep_rules.front().dependencies);
+                std::erase(nfo.includes, files[i].lexically_normal());
+            }
+            result[i] = std::move(nfo);
+            break;
+        }
+    }
+
+    auto make_cdb_path = tmpdir/std::format("batch{}_make.json", batch);
+    if (!without_depfile.empty()) {
+        Json::Array make_cdb;
+        for (auto i: without_depfile) make_cdb.push_back(cdb[i]);
+        write_compilation_database(make_cdb_path, make_cdb);
+        scan_args.clear();
+        append_arguments(scan_args, {"-format=make","-compilation-database={}"}, {path_arg(make_cdb_path)});
+        invocations.add();
+        make_passes.add();
+        auto p = Process::spawn(scanner, workdir, scan_args, Process::output);
+        auto dep_rules = parse_depfile_rules(std::string(std::istreambuf_iterator<char>(*p.stdout_stream),
+                                                         std::istreambuf_iterator<char>()), workdir);
+        if (p.waitpid_status() != 0) {
+            Log::warning("{} reported errors", [&]{return scanner.string();});
+        }
+        for (auto i: without_depfile) {
+            auto iter = std::find_if(dep_rules.begin(), dep_rules.end(), [&](const DepfileRule &d){
+                return d.target == outputs[i];
+            });
+            if (iter == dep_rules.end()) {
+                //included files are not known, changes of headers would not be detected
+                result[i].reset();
+                continue;
+            }
+            result[i]->includes = std::move(iter->dependencies);
+            std::erase(result[i]->includes, files[i].lexically_normal());
+        }
+    }
+    std::error_code ec;
+    std::filesystem::remove(cdb_path, ec);
+    std::filesystem::remove(make_cdb_path, ec);
+    for (const auto &d: depfiles) std::filesystem::remove(d, ec);
+    return result;
+}
+
+///Scans a file by gcc with -fdeps-format=p1689r5
+/**
+ * @param compiler path to the compiler
+ * @param args arguments of compilation
+ * @param workdir working directory of compilation
+ * @param file file to scan
+ * @param tmpdir directory for temporary files
+ * @return result of scan, nullopt when the file was not scanned
+ */
+export inline std::optional<SourceScanner::Info> run_gcc_p1689(
+        const std::filesystem::path &compiler,
+        std::span<const ArgumentString> args,
+        const std::filesystem::path &workdir,
+        const std::filesystem::path &file,
+        const std::filesystem::path &tmpdir) {
+
+    static auto &invocations = Stats::counter("scanner.p1689_invocations");
+    static std::atomic<unsigned int> file_counter = 0;
+    auto base = tmpdir/std::format("file{}", file_counter++);
+    auto ddi = base;
+    ddi += ".ddi";
+    auto dep = base;
+    dep += ".d";
+    auto obj = base;
+    obj += ".o";
+    //preprocessed output is not needed
+#ifdef _WIN32
+    std::filesystem::path null_device = "NUL";
+#else
+    std::filesystem::path null_device = "/dev/null";
+#endif
+
+    std::vector<ArgumentString> cmd(args.begin(), args.end());
+    append_arguments(cmd, {"-E","-x","c++","{}","-fmodules-ts","-fdeps-format=p1689r5",
+                           "-fdeps-file={}","-fdeps-target={}","-MD","-MF","{}","-o","{}"},
+                        {path_arg(file), path_arg(ddi), path_arg(obj), path_arg(dep), path_arg(null_device)});
+    invocations.add();
+    auto p = Process::spawn(compiler, workdir, cmd, Process::no_streams);
+    std::optional<SourceScanner::Info> result;
+    if (p.waitpid_status() == 0) {
+        std::ifstream f(ddi, std::ios::in|std::ios::binary);
+        try {
+            Json ddi_json = read_json(f);
+            const auto &rules = p1689_field(ddi_json, "rules").as_array();
+            if (!rules.empty()) {
+                auto nfo = p1689_rule_to_info(rules.front());
+                p1689_detect_implementation(file, nfo);
+                p1689_detect_exports(file, nfo);
+                nfo.includes = parse_depfile(read_text_file(dep), workdir, file);
+                result = std::move(nfo);
+            }
+        } catch (const Json::ParseError &e) {
+            Log::error("Failed to parse {}: {}", [&]{return ddi.string();}, e.what());
+        }
+    }
+    std::error_code ec;
+    for (const auto &x: {ddi, dep}) std::filesystem::remove(x, ec);
+    return result;
+}
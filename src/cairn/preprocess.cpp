@@ -1,122 +1,115 @@
 module cairn.preprocess;
 
+import cairn.utils.stats;
+
+import <algorithm>;
+import <charconv>;
+import <deque>;
+import <limits>;
 import <utility>;
-import <queue>;
 import <fstream>;
+import <mutex>;
 
 
-template<typename Fn>
-std::string read_string(Fn &&fn, std::string beg) {
-    bool slash = false;
-    int c = fn();
-    while (c != -1 && (slash || c != '"')) {
-        beg.push_back(static_cast<char>(c));
-        slash = c == '\\';
-        c = fn();
-    }
-    beg.push_back('\"');
-    return beg;
+auto StupidPreprocessor::tokenizer_from_stream(std::span<const Token> stream) {
+    return [stream]() mutable {
+        if (stream.empty()) return Token{TokenType::eof, {}};
+        else {
+            auto r = stream.front();
+            stream = stream.subspan(1);
+            return r;
+        }
+    };
 }
 
-template<typename Fn>
-auto StupidPreprocessor::tokenizer(Fn &&fn) {
-    return [fn = std::forward<Fn>(fn), cur = Token()]() mutable {        
+auto StupidPreprocessor::tokenizer_from_args(std::size_t begin, std::size_t end) {
+    //indices, as _arg_tokens can grow during expansion
+    return [this, begin, end]() mutable {
+        if (begin >= end) return Token{TokenType::eof, {}};
+        return _arg_tokens[begin++];
+    };
+}
+
+auto StupidPreprocessor::tokenizer_from_string(std::string_view line) {
+    //tokens are views of the line, the current token is extended by following characters
+    return [line, pos = std::size_t(0), cur = Token()]() mutable {
         if (cur.type == TokenType::eof) return cur;
+        auto extend = [&]{cur.content = std::string_view(cur.content.data(), cur.content.size() + 1);};
+        auto start = [&](TokenType type) {return std::exchange(cur, Token{type, line.substr(pos - 1, 1)});};
         while (true) {
-            int c = fn();
-            if (c == -1) {
+            if (pos >= line.size()) {
                 return std::exchange(cur, Token {TokenType::eof});
             }
-            char cc = static_cast<char>(c);
+            int c = static_cast<unsigned char>(line[pos++]);
             if (std::isspace(c)) {
                 if (cur.type == TokenType::white) {
-                    cur.content.push_back(cc);
+                    extend();
                 } else {
-                    return std::exchange(cur,Token{TokenType::white, {&cc,1}});
+                    return start(TokenType::white);
                 }
             } else if (c == '_' || std::isalnum(c)) {
                 if ((std::isdigit(c) && cur.type == TokenType::number) 
                     || (std::isxdigit(c) && cur.type == TokenType::xnumber)
                     || cur.type == TokenType::identifier) {
-                        cur.content.push_back(cc);                                        
+                        extend();
                 } else if (cur.type == TokenType::number && cur.content.front()=='0' && c == 'x') {
                     cur.type = TokenType::xnumber;
-                    cur.content.push_back(cc);
+                    extend();
                 } else if (std::isdigit(c)) {
-                    return std::exchange(cur, Token{TokenType::number, {&cc,1}});
+                    return start(TokenType::number);
                 } else if ((c == 'L' || c == 'U') && (cur.type == TokenType::number || cur.type == TokenType::number_suffixed)) {
-                        cur.content.push_back(cc);
+                        extend();
                         cur.type = TokenType::number_suffixed;
                 } else if ((c == 'L' || c == 'U') && (cur.type == TokenType::xnumber || cur.type == TokenType::xnumber_suffixed)) {
-                        cur.content.push_back(cc);
+                        extend();
                         cur.type = TokenType::xnumber_suffixed;
                 } else {
-                    return std::exchange(cur, Token{TokenType::identifier, {&cc,1}});
+                    return start(TokenType::identifier);
                 }
             } else if (c == '"') {
-                return std::exchange(cur, Token{TokenType::string, read_string(fn,{&cc,1})});
-            
+                auto beg = pos - 1;
+                bool slash = false;
+                while (pos < line.size() && (slash || line[pos] != '"')) {
+                    slash = line[pos] == '\\';
+                    ++pos;
+                }
+                if (pos < line.size()) ++pos;   //closing quote
+                return std::exchange(cur, Token{TokenType::string, line.substr(beg, pos - beg)});
             } else {
                 if (c == '+' || c == '-' || c=='!' || cur.type != TokenType::symbol) {                    
-                    return std::exchange(cur, Token{TokenType::symbol, {&cc,1}});
+                    return start(TokenType::symbol);
                 } else {
-                    cur.content.push_back(static_cast<char>(c));
+                    extend();
                 }
             }
         }
     };
 }
 
-auto StupidPreprocessor::tokenizer_from_stream(std::span<const Token> stream) {
-    return [stream]() mutable {
-        if (stream.empty()) return Token{TokenType::eof, {}};
-        else {
-            auto r = stream.front();
-            stream = stream.subspan(1);
-            return r;
-        }
-    };
-}
-
-auto StupidPreprocessor::tokenizer_from_string(std::string_view line) {
-    return tokenizer([=]()mutable {
-        if (line.empty()) return -1;
-        int r = static_cast<unsigned char>(line.front());
-        line = line.substr(1);
-        return r;
-    });
-}
-
-auto stream_reader(std::istream &in) {
-    return [&]() mutable {
-        return in.get();
-    };
-}
-
-
 template<typename Source>
-auto unwrap_lines(Source &&src) {
-
-    return [src = std::forward<Source>(src), extra = std::queue<int>() ]() mutable {
+auto unwrap_lines(Source &&src, std::string &extra) {
+    //extra - characters read ahead, buffer is provided by caller to be reused
+    extra.clear();
+    return [src = std::forward<Source>(src), &extra, pos = std::size_t(0)]() mutable {
         while (true) {
-            if (!extra.empty()) {
-                int r = extra.front();
-                extra.pop();
-                return r;
+            if (pos < extra.size()) {
+                return static_cast<int>(static_cast<unsigned char>(extra[pos++]));
             }
+            extra.clear();
+            pos = 0;
             int c = src();
             if (c != '\\') return c;
-            extra.push(c);
+            extra.push_back(static_cast<char>(c));
             do {
                 c = src();            
-                extra.push(c);
+                if (c != -1) extra.push_back(static_cast<char>(c));
             } while (c != -1 && c != '\n' && std::isspace(c));
             if (c == -1) {
-                extra = {};
+                extra.clear();
                 return c;
             }
             if (c == '\n') {
-                extra = {};
+                extra.clear();
             }
         }
     };
@@ -166,7 +159,7 @@ auto remove_comments(Source &&src) {
 }
 
 template<typename Source>
-bool get_line(Source &&src, std::string &ln) {
+bool read_line(Source &&src, std::string &ln) {
     ln.clear();
     int c = src();
     while (c != -1 && c != '\n') {
@@ -176,28 +169,252 @@ bool get_line(Source &&src, std::string &ln) {
     return c != -1;
 }
 
+bool StupidPreprocessor::read_source(const std::filesystem::path &p, std::string &out) {
+    static auto &files = Stats::counter("preprocessor.files_opened");
+    static auto &bytes = Stats::counter("preprocessor.bytes_read", Stats::Unit::bytes);
+    std::ifstream f(p, std::ios::in|std::ios::binary);
+    if (!f.is_open()) return false;
+    f.seekg(0, std::ios::end);
+    auto sz = f.tellg();
+    f.seekg(0, std::ios::beg);
+    out.resize(sz > 0?static_cast<std::size_t>(sz):0);
+    f.read(out.data(), static_cast<std::streamsize>(out.size()));
+    out.resize(static_cast<std::size_t>(f.gcount()));
+    files.add();
+    bytes.add(out.size());
+    return true;
+}
+
+bool StupidPreprocessor::LineReader::get_line(std::string_view &ln) {
+    auto rest = _text.substr(_pos);
+    auto nl = rest.find('\n');
+    auto seg = rest.substr(0, nl);
+    if (seg.find('/') == seg.npos && seg.find('\\') == seg.npos) {
+        if (!seg.empty() && seg.back() == '\r') seg.remove_suffix(1);
+        if (seg.find('\r') == seg.npos) {
+            ln = seg;
+            if (nl == rest.npos) {
+                _pos = _text.size();
+                return false;
+            }
+            _pos += nl + 1;
+            return true;
+        }
+    }
+    //a comment or a continuation can span multiple lines
+    auto src = remove_comments(unwrap_lines([this]{
+        return _pos < _text.size()?static_cast<int>(static_cast<unsigned char>(_text[_pos++])):-1;
+    }, _pending));
+    bool r = read_line(src, _buffer);
+    ln = _buffer;
+    return r;
+}
+
+static std::filesystem::file_time_type file_time(const std::filesystem::path &p) {
+    static auto &stat_cnt = Stats::counter("preprocessor.header_stamps");
+    stat_cnt.add();
+    std::error_code ec;
+    auto tm = std::filesystem::last_write_time(p, ec);
+    return ec?std::filesystem::file_time_type::min():tm;
+}
+
+class StupidPreprocessor::HeaderCache {
+public:
+
+    ///Result of processing of a header in a particular macro state (names are from the symbol table)
+    struct Entry {
+        std::vector<std::pair<std::string_view, std::optional<MacroDef> > > reads;
+        std::vector<std::pair<std::filesystem::path, bool> > include_reads;
+        std::vector<std::pair<std::string_view, std::optional<MacroDef> > > effect;
+        std::vector<std::filesystem::path> included;
+        std::vector<std::filesystem::path> disabled;
+        std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type> > files;
+    };
+
+    using PEntry = std::shared_ptr<const Entry>;
+
+    std::vector<PEntry> find(const std::string &key) const {
+        std::lock_guard _(_mx);
+        auto iter = _entries.find(key);
+        if (iter == _entries.end()) return {};
+        return iter->second;
+    }
+
+    void store(const std::string &key, PEntry e) {
+        std::lock_guard _(_mx);
+        auto &lst = _entries[key];
+        if (lst.size() < max_variants) lst.push_back(std::move(e));
+    }
+
+protected:
+    //a header included in too many different states is not worth of caching
+    static constexpr std::size_t max_variants = 8;
+
+    mutable std::mutex _mx;
+    std::unordered_map<std::string, std::vector<PEntry> > _entries;
+};
+
+class StupidPreprocessor::SymbolTable {
+public:
+
+    SymbolTable() = default;
+    ///Table extending a parent, the parent is no longer changed
+    explicit SymbolTable(std::shared_ptr<const SymbolTable> parent):_parent(std::move(parent)) {}
+
+    ///Parsed macro definition, tokens refer to the text
+    struct Definition {
+        std::string text;
+        std::string_view name;
+        std::vector<Token> body;
+        std::optional<std::vector<std::string_view> > variables;
+        bool valid = false;
+
+        MacroDef macro() const {
+            MacroDef m{body, std::nullopt};
+            if (variables.has_value()) m.variables = std::span<const std::string_view>(*variables);
+            return m;
+        }
+    };
+
+    std::string_view intern(std::string_view name) {
+        if (_parent) {
+            if (auto n = _parent->find_name(name)) return *n;
+        }
+        std::lock_guard _(_mx);
+        auto iter = _names.find(name);
+        if (iter != _names.end()) return *iter;
+        //deque doesn't move its items, so views are stable
+        const auto &s = _strings.emplace_back(name);
+        _names.insert(s);
+        return s;
+    }
+
+    ///Retrieves definition of given text, parses it when seen first time
+    /**
+     * @param text text of definition
+     * @param parse function which receives new Definition with the text
+     * @return parsed definition
+     */
+    template<typename Fn>
+    const Definition &definition(std::string_view text, Fn &&parse) {
+        if (_parent) {
+            if (auto d = _parent->find_definition(text)) return *d;
+        }
+        std::lock_guard _(_mx);
+        auto iter = _definitions.find(text);
+        if (iter != _definitions.end()) return *iter->second;
+        auto &def = _storage.emplace_back();
+        def.text = text;
+        parse(def);
+        _definitions.emplace(def.text, &def);
+        return def;
+    }
+
+protected:
+    std::shared_ptr<const SymbolTable> _parent;
+    mutable std::mutex _mx;
+    std::deque<std::string> _strings;
+    std::unordered_set<std::string_view> _names;
+    std::deque<Definition> _storage;
+    std::unordered_map<std::string_view, const Definition *> _definitions;
+
+    std::optional<std::string_view> find_name(std::string_view name) const {
+        if (_parent) {
+            if (auto n = _parent->find_name(name)) return n;
+        }
+        std::lock_guard _(_mx);
+        auto iter = _names.find(name);
+        if (iter == _names.end()) return std::nullopt;
+        return *iter;
+    }
+
+    const Definition *find_definition(std::string_view text) const {
+        if (_parent) {
+            if (auto d = _parent->find_definition(text)) return d;
+        }
+        std::lock_guard _(_mx);
+        auto iter = _definitions.find(text);
+        return iter == _definitions.end()?nullptr:iter->second;
+    }
+};
+
+
+bool StupidPreprocessor::MacroDef::operator==(const MacroDef &other) const {
+    if (variables.has_value() != other.variables.has_value()) return false;
+    if (variables.has_value() && !std::ranges::equal(*variables, *other.variables)) return false;
+    return std::ranges::equal(content, other.content);
+}
+
+StupidPreprocessor::StupidPreprocessor()
+    :_header_cache(std::make_shared<HeaderCache>())
+    ,_symbols(std::make_shared<SymbolTable>()) {}
+
+void StupidPreprocessor::freeze_macros() {
+    _context.freeze();
+    _frozen_symbols = _symbols;
+    _symbols = std::make_shared<SymbolTable>(_frozen_symbols);
+}
+
+void StupidPreprocessor::reset_caches() {
+    //memoized headers refer to the symbols, both are released together
+    _header_cache = std::make_shared<HeaderCache>();
+    if (_frozen_symbols) _symbols = std::make_shared<SymbolTable>(_frozen_symbols);
+}
+
+const StupidPreprocessor::MacroDef *StupidPreprocessor::find_macro(std::string_view name) {
+    const MacroDef *def = _context.find(name);
+    for (auto &rc: _recordings) {
+        std::string n(name);
+        if (!rc.written.contains(n) && !rc.reads.contains(n)) {
+            rc.reads.emplace(std::move(n), def?std::optional<MacroDef>(*def):std::nullopt);
+        }
+    }
+    return def;
+}
+
+void StupidPreprocessor::note_write(std::string_view name) {
+    for (auto &rc: _recordings) rc.written.emplace(name);
+}
+
+void StupidPreprocessor::note_include(const std::filesystem::path &path, bool disabled) {
+    for (auto &rc: _recordings) {
+        if (rc.disabled.contains(path)) continue;
+        rc.include_reads.emplace(path, disabled);
+        if (!disabled) rc.disabled.insert(path);
+    }
+}
+
+void StupidPreprocessor::note_file(const std::filesystem::path &path, std::filesystem::file_time_type tm) {
+    for (auto &rc: _recordings) rc.files.emplace_back(path, tm);
+}
+
 static std::string_view trim(std::string_view x) {
     while (!x.empty() && std::isspace(x.front())) x = x.substr(1);
     while (!x.empty() && std::isspace(x.back())) x = x.substr(0, x.length()-1);
     return x;
 }
 
-StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::path &cur_dir, std::istream &in, ScanMode mode, std::ostream &out,
+StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::path &cur_dir, std::string_view text, ScanMode mode, LineSink out,
+    std::unordered_set<std::filesystem::path> &&disabled_includes) {
+    LineReader in(text);
+    return run(cur_dir, in, mode, out, std::move(disabled_includes));
+}
+
+StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::path &cur_dir, LineReader &in, ScanMode mode, LineSink out,
     std::unordered_set<std::filesystem::path> &&disabled_includes) {
 
-    auto src = remove_comments(unwrap_lines(stream_reader(in)));
-    std::string ln;
+    std::string_view ln;
     bool st;
     do {
-        st = get_line(src, ln);
+        st = in.get_line(ln);
         auto lnv = trim(ln);
         auto sep = std::min(lnv.find(' '), lnv.size());
         auto cmdstr = lnv.substr(0,sep);
         auto args = trim(lnv.substr(sep));
         auto cmd = find(cmdstr) ;        
         if (cmd == Command::eof) {
-            if (mode == ScanMode::copy) {
-                out << ln << std::endl;     //we don't expand macros in code
+            if (mode == ScanMode::copy && !out(ln)) {     //we don't expand macros in code
+                return {Command::stop, {}};
             }
         } else {
             std::optional<bool> cond = {};
@@ -205,7 +422,7 @@ StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::p
                 case Command::_endif:
                 case Command::_else:
                 case Command::_elif:
-                case Command::_elifdef: return {cmd, std::string(args)};
+                case Command::_elifdef: return {cmd, args};
                 case Command::_define: if (mode != ScanMode::skip) parse_define(args);break;
                 case Command::_undef: if (mode != ScanMode::skip) parse_undef(args);break;
                 case Command::_include:if (mode != ScanMode::skip) parse_include(cur_dir, args, std::move(disabled_includes));break;
@@ -218,6 +435,7 @@ StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::p
                 bool res = *cond;
                 auto r  = run(cur_dir, in, res?mode:ScanMode::skip, out, std::move(disabled_includes));
                 while (r.cmd != Command::eof && r.cmd != Command::_endif) {
+                    if (r.cmd == Command::stop) return r;
                     switch (r.cmd) {
                         case Command::_else:  res = !res;break;
                         case Command::_elif: cond = parse_if(r.args);break;
@@ -234,28 +452,33 @@ StupidPreprocessor::NextCommand StupidPreprocessor::run(const std::filesystem::p
 }
 
 void StupidPreprocessor::parse_define(std::string_view args){
-    auto next_token = tokenizer_from_string(args);
-    next_token();   //drop begin;
-    auto name = next_token();
-    if (name.type == TokenType::eof) return;
-    MacroDef def;
-    Token f = next_token();
-    if (f.content =="(") {
-        Token c = next_token();
-        def.variables.emplace();
-        while (c.type != TokenType::eof && c.content != ")") {
-            if (c.type == TokenType::identifier) def.variables->push_back(c.content);
-            c = next_token();
-        }    
-    } else if (f.type != TokenType::white) {
-        return;
-    }
-    f = next_token();
-    while (f.type != TokenType::eof) {
-        def.content.push_back(f);
+    const auto &def = symbols().definition(args, [](SymbolTable::Definition &d){
+        auto next_token = tokenizer_from_string(d.text);
+        next_token();   //drop begin;
+        auto name = next_token();
+        if (name.type == TokenType::eof) return;
+        d.name = name.content;
+        Token f = next_token();
+        if (f.content =="(") {
+            Token c = next_token();
+            d.variables.emplace();
+            while (c.type != TokenType::eof && c.content != ")") {
+                if (c.type == TokenType::identifier) d.variables->push_back(c.content);
+                c = next_token();
+            }    
+        } else if (f.type != TokenType::white) {
+            return;
+        }
         f = next_token();
-    }
-    _context[name.content] = def;
+        while (f.type != TokenType::eof) {
+            d.body.push_back(f);
+            f = next_token();
+        }
+        d.valid = true;
+    });
+    if (!def.valid) return;
+    _context.define(def.name, def.macro());
+    note_write(def.name);
 
 }
 void StupidPreprocessor::parse_undef(std::string_view args){
@@ -263,8 +486,9 @@ void StupidPreprocessor::parse_undef(std::string_view args){
     next_token();   //drop begin;
     auto name = next_token();
     if (name.type == TokenType::eof) return;
-    _context.erase(name.content);
-    
+    auto n = symbols().intern(name.content);
+    _context.undef(n);
+    note_write(n);
 }
 void StupidPreprocessor::parse_include(const std::filesystem::path &cur_dir, std::string_view args, 
         std::unordered_set<std::filesystem::path> &&disabled_includes ){
@@ -287,6 +511,8 @@ void StupidPreprocessor::parse_include(const std::filesystem::path &cur_dir, std
     final_path = (cur_dir/path).lexically_normal();
     if (end.front() != '"') {
         for (auto &i: _includes) {
+            static auto &stat_cnt = Stats::counter("preprocessor.include_probes");
+            stat_cnt.add();
             std::error_code ec;
             auto cand = std::filesystem::canonical(i/path, ec);
             if (ec == std::errc{}) {
@@ -296,13 +522,83 @@ void StupidPreprocessor::parse_include(const std::filesystem::path &cur_dir, std
         }
     }
 
-    if (disabled_includes.insert(final_path).second) {
-        std::ifstream file(final_path);
-        if (file.is_open()) {
-            std::ostringstream dummy;
-            run(final_path.parent_path(), file, ScanMode::collect, dummy, std::move(disabled_includes));
-        }    
+    bool disabled = !disabled_includes.insert(final_path).second;
+    note_include(final_path, disabled);
+    if (disabled) return;
+
+    auto key = _includes_key + final_path.string();
+    if (replay_header(key, disabled_includes)) return;
+
+    static auto &misses = Stats::counter("preprocessor.header_cache_misses");
+    misses.add();
+    auto tm = file_time(final_path);
+    std::string text;
+    if (!read_source(final_path, text)) {
+        note_file(final_path, std::filesystem::file_time_type::min());
+        return;
+    }
+    _recordings.emplace_back();
+    _recordings.back().disabled.insert(final_path);
+    _recordings.back().included_start = _included.size();
+    note_file(final_path, tm);
+    _included.push_back(final_path);
+    run(final_path.parent_path(), text, ScanMode::collect, {}, std::move(disabled_includes));
+    auto rc = std::move(_recordings.back());
+    _recordings.pop_back();
+
+    auto e = std::make_shared<HeaderCache::Entry>();
+    for (const auto &[n, d]: rc.reads) e->reads.emplace_back(symbols().intern(n), d);
+    e->include_reads.assign(rc.include_reads.begin(), rc.include_reads.end());
+    for (const auto &n: rc.written) {
+        auto def = _context.find(n);
+        e->effect.emplace_back(symbols().intern(n), def?std::optional<MacroDef>(*def):std::nullopt);
+    }
+    e->included.assign(_included.begin() + static_cast<std::ptrdiff_t>(rc.included_start), _included.end());
+    e->disabled.assign(rc.disabled.begin(), rc.disabled.end());
+    e->files = std::move(rc.files);
+    _header_cache->store(key, std::move(e));
+}
+
+bool StupidPreprocessor::replay_header(const std::string &key, std::unordered_set<std::filesystem::path> &disabled_includes) {
+    static auto &hits = Stats::counter("preprocessor.header_cache_hits");
+    auto matches = [&](const HeaderCache::Entry &e) {
+        for (const auto &[n, d]: e.reads) {
+            auto def = _context.find(n);
+            if (def?(!d.has_value() || *d != *def):d.has_value()) return false;
+        }
+        for (const auto &[p, dis]: e.include_reads) {
+            if (disabled_includes.contains(p) != dis) return false;
+        }
+        for (const auto &[p, tm]: e.files) {
+            if (file_time(p) != tm) return false;
+        }
+        return true;
+    };
+    for (const auto &e: _header_cache->find(key)) {
+        if (!matches(*e)) continue;
+        hits.add();
+        //outer recordings see the same reads and effects, as the header was processed
+        for (const auto &[n, d]: e->reads) {
+            for (auto &rc: _recordings) {
+                std::string name(n);
+                if (!rc.written.contains(name)) rc.reads.emplace(std::move(name), d);
+            }
+        }
+        for (const auto &[p, dis]: e->include_reads) note_include(p, dis);
+        for (const auto &p: e->disabled) {
+            disabled_includes.insert(p);
+            for (auto &rc: _recordings) rc.disabled.insert(p);
+        }
+        for (const auto &[n, d]: e->effect) {
+            if (d.has_value()) _context.define(n, *d);
+            else _context.undef(n);
+            note_write(n);
+        }
+        _included.insert(_included.end(), e->included.begin(), e->included.end());
+        for (const auto &[p, tm]: e->files) note_file(p, tm);
+        return true;
     }
+    return false;
 }
 
 std::pair<long, StupidPreprocessor::Token> StupidPreprocessor::evaluate_oror(auto &&next_token) {
@@ -422,6 +718,14 @@ std::pair<long, StupidPreprocessor::Token> StupidPreprocessor::evaluate_multiply
     return a;
 
 }
+//parses leading digits, saturates as strtol
+static long parse_number(std::string_view str, int base) {
+    long l = 0;
+    auto r = std::from_chars(str.data(), str.data() + str.size(), l, base);
+    if (r.ec == std::errc::result_out_of_range) l = std::numeric_limits<long>::max();
+    return l;
+}
+
 std::pair<long, StupidPreprocessor::Token> StupidPreprocessor::evaluate_unar(auto &&next_token) {
 
     auto fetch_next = [&]{
@@ -446,11 +750,11 @@ std::pair<long, StupidPreprocessor::Token> StupidPreprocessor::evaluate_unar(aut
         return b;
     }
     if (t.type == TokenType::number || t.type == TokenType::number_suffixed) {
-        auto l = std::strtol(t.content.c_str(), NULL,t.content.front() == '0'?8:10);
+        auto l = parse_number(t.content, t.content.front() == '0'?8:10);
         return {l, fetch_next()};        
     }
     if (t.type == TokenType::xnumber || t.type == TokenType::xnumber_suffixed) {
-        auto l = std::strtol(t.content.c_str()+2, NULL,16);
+        auto l = parse_number(t.content.substr(2), 16);
         return {l, fetch_next()};        
     }
     return {0,t};
@@ -463,10 +767,9 @@ long StupidPreprocessor::evaluate(auto &&next_token) {
 }
 
 bool StupidPreprocessor::parse_if(std::string_view args){
-    std::vector<Token> stream;
-    std::unordered_set<std::string> dummy;
-    preproc_line(tokenizer_from_string(args), stream, {}, dummy, true);
-    long result = evaluate(tokenizer_from_stream(stream));
+    _token_stream.clear();
+    preproc_line(tokenizer_from_string(args), 0, 0, true);
+    long result = evaluate(tokenizer_from_stream(_token_stream));
     return result != 0;
 }
 
@@ -475,18 +778,22 @@ bool StupidPreprocessor::parse_ifdef(std::string_view args){
     next_token();   //drop begin;
     auto name = next_token();
     if (name.type == TokenType::eof) return false;
-    return _context.contains(name.content);
+    return find_macro(name.content) != nullptr;
 
 }
 
 
 
 template<typename Fn>
-void StupidPreprocessor::preproc_line(Fn &&next_token, std::vector<Token> &token_stream, const MacroMap &arguments, std::unordered_set<std::string> &deactivated, bool cond) const {
+void StupidPreprocessor::preproc_line(Fn &&next_token, std::size_t args_begin, std::size_t args_end, bool cond) {
+    auto find_arg = [&](std::string_view name) {
+        for (auto i = args_begin; i < args_end; ++i) if (_args[i].name == name) return i;
+        return args_end;
+    };
     Token t = next_token();
     while (t.type != TokenType::eof) {
         if (t.type != TokenType::begin && t.type != TokenType::white) {
-            MacroMap::const_iterator mvaritr;
+            std::size_t arg;
             if (t.type == TokenType::identifier) {
                 if (cond && t.content == "defined") {
 
@@ -499,73 +806,82 @@ void StupidPreprocessor::preproc_line(Fn &&next_token, std::vector<Token> &token
                     } else {
                         std::swap(u,v);
                     }
-                    if (_context.contains(v.content)) {
-                        token_stream.push_back({TokenType::number,"1"});
+                    if (find_macro(v.content)) {
+                        _token_stream.push_back({TokenType::number,"1"});
                     } else {
-                        token_stream.push_back({TokenType::number,"0"});
+                        _token_stream.push_back({TokenType::number,"0"});
                     }
                     if (u.type != TokenType::begin) {
                         u = next_token();
                         while (u.type != TokenType::eof && u.content != ")") u = next_token();
                     }
-                } else if ((mvaritr = arguments.find(t.content)) != arguments.end()) {
+                } else if ((arg = find_arg(t.content)) != args_end) {
                     //not supporting expansion of function inside expansion - too much clever
-                    preproc_line(tokenizer_from_stream(mvaritr->second.content), token_stream, {}, deactivated, cond);
-                } else if (deactivated.find(t.content) == deactivated.end()) {
-                    auto iter = _context.find(t.content);
-                    if (iter != _context.end()) {
+                    preproc_line(tokenizer_from_args(_args[arg].begin, _args[arg].end), 0, 0, cond);
+                } else if (std::find(_deactivated.begin(), _deactivated.end(), t.content) == _deactivated.end()) {
+                    const MacroDef *def = find_macro(t.content);
+                    if (def) {
 
-                        if (iter->second.variables.has_value()) {
+                        if (def->variables.has_value()) {
                             Token c = next_token();
                             while (c.type == TokenType::white) c = next_token();
                             if (c.content == "(") {
-                                MacroMap new_args;
-                                auto atr = iter->second.variables->begin();
+                                //arguments are appended to _args and _arg_tokens, removed after expansion
+                                auto args_mark = _args.size();
+                                auto tokens_mark = _arg_tokens.size();
+                                auto vars = *def->variables;
+                                auto atr = vars.begin();
                                 c = next_token();
                                 int level = 1;
-                                auto strm = &new_args[*atr].content;
+                                if (atr != vars.end()) _args.push_back({*atr, tokens_mark, tokens_mark});
+                                auto store = [&](const Token &x) {
+                                    if (atr != vars.end()) _arg_tokens.push_back(x);
+                                };
                                 while (c.type != TokenType::eof && level) {
                                     c = next_token();
                                     if (level ==0 && c.content ==",") {
                                         auto tmp = atr;
                                         ++tmp;
-                                        if (tmp != iter->second.variables->end()) {
+                                        if (tmp != vars.end()) {
                                             atr = tmp;
-                                            strm = &new_args[*atr].content;
+                                            _args.back().end = _arg_tokens.size();
+                                            _args.push_back({*atr, _arg_tokens.size(), _arg_tokens.size()});
                                         } else {
-                                            strm->push_back(c);
+                                            store(c);
                                         }
                                     } else if (c.content == "(") {
-                                        strm->push_back(c);
+                                        store(c);
                                         ++level;
                                     } else if (c.content == ")") {
                                         --level;
-                                        if (level) strm->push_back(c);
+                                        if (level) store(c);
                                     } else {
-                                        strm->push_back(c);
+                                        store(c);
                                     }
                                 }
-                                deactivated.insert(iter->first);
-                                preproc_line(tokenizer_from_stream(iter->second.content), 
-                                    token_stream, new_args, deactivated, cond);
-                                deactivated.erase(iter->first);
+                                if (atr != vars.end()) _args.back().end = _arg_tokens.size();
+                                _deactivated.push_back(t.content);
+                                preproc_line(tokenizer_from_stream(def->content), args_mark, _args.size(), cond);
+                                _deactivated.pop_back();
+                                _args.resize(args_mark);
+                                _arg_tokens.resize(tokens_mark);
                             } else {
-                                token_stream.push_back(t);
-                                token_stream.push_back(c);
+                                _token_stream.push_back(t);
+                                _token_stream.push_back(c);
                             }
                         } else {
-                            deactivated.insert(t.content);
-                            preproc_line(tokenizer_from_stream(iter->second.content), token_stream, {}, deactivated, cond);
-                            deactivated.erase(t.content);
+                            _deactivated.push_back(t.content);
+                            preproc_line(tokenizer_from_stream(def->content), 0, 0, cond);
+                            _deactivated.pop_back();
                         }
                     } else {
-                        token_stream.push_back(t);
+                        _token_stream.push_back(t);
                     }
                 } else {
-                    token_stream.push_back(t);
+                    _token_stream.push_back(t);
                 }
             }  else {
-                token_stream.push_back(t);
+                _token_stream.push_back(t);
             }
         }
         t = next_token();
@@ -573,32 +889,118 @@ void StupidPreprocessor::preproc_line(Fn &&next_token, std::vector<Token> &token
 }
 
 void StupidPreprocessor::append_includes(std::span<const std::filesystem::path> paths) {
-    _includes.insert(_includes.end(), paths.begin(), paths.end());
+    for (const auto &p: paths) append_includes(p);
 }
 void StupidPreprocessor::append_includes(const std::filesystem::path &path) {
     _includes.push_back(path);
+    _includes_key.append(path.string());
+    _includes_key.push_back('\n');
 }
 
 void StupidPreprocessor::define_symbol(std::string symbol, std::string value) {
-    std::vector<Token> stream;
-    auto next_symbol = tokenizer_from_string(value);
-    auto s = next_symbol();
-    auto &ctx = _context[symbol];
-    s = next_symbol();
-    while (s.type != TokenType::eof) {
-        ctx.content.push_back(s);
+    //newline separates the name, so the key never collides with a #define
+    const auto &def = symbols().definition(symbol + '\n' + value, [&](SymbolTable::Definition &d){
+        std::string_view text = d.text;
+        d.name = text.substr(0, symbol.size());
+        auto next_symbol = tokenizer_from_string(text.substr(symbol.size() + 1));
+        auto s = next_symbol();
         s = next_symbol();
-    }        
+        while (s.type != TokenType::eof) {
+            d.body.push_back(s);
+            s = next_symbol();
+        }
+        d.valid = true;
+    });
+    _context.define(def.name, def.macro());
 }
 void StupidPreprocessor::undef_symbol(const std::string &symbol) {
-    _context.erase(symbol);
+    _context.undef(symbols().intern(symbol));
+}
+
+const StupidPreprocessor::MacroDef *StupidPreprocessor::MacroContext::find(std::string_view name) const {
+    auto iter = _overlay.find(name);
+    if (iter != _overlay.end()) return iter->second.has_value()?&*iter->second:nullptr;
+    if (!_base) return nullptr;
+    auto biter = _base->find(name);
+    return biter == _base->end()?nullptr:&biter->second;
+}
+
+void StupidPreprocessor::MacroContext::define(std::string_view name, MacroDef def) {
+    _overlay.insert_or_assign(name, std::move(def));
+}
+
+void StupidPreprocessor::MacroContext::undef(std::string_view name) {
+    if (_base && _base->contains(name)) _overlay.insert_or_assign(name, std::nullopt);
+    else _overlay.erase(name);
+}
+
+void StupidPreprocessor::MacroContext::freeze() {
+    if (_overlay.empty()) return;
+    auto m = _base?*_base:MacroMap();
+    for (auto &[n, d]: _overlay) {
+        if (d.has_value()) m.insert_or_assign(n, std::move(*d));
+        else m.erase(n);
+    }
+    _overlay.clear();
+    _base = std::make_shared<const MacroMap>(std::move(m));
 }
 
 std::string StupidPreprocessor::run(const std::filesystem::path &workdir, const std::filesystem::path &src_file) {
-    std::ostringstream out;
-    std::ifstream indata(src_file);
-    if (!indata) return {};
-    run(workdir, indata, ScanMode::copy, out, {});;
-    return std::move(out).str();
+    std::string out;
+    std::string text;
+    if (!read_source(src_file, text)) return {};
+    out.reserve(text.size());
+    run(workdir, text, ScanMode::copy, [&](std::string_view ln){
+        out.append(ln);
+        out.push_back('\n');
+        return true;
+    }, {});
+    return out;
+
+}
+void StupidPreprocessor::run(const std::filesystem::path &workdir, const std::filesystem::path &src_file, LineSink out) {
+    std::string text;
+    if (!read_source(src_file, text)) return;
+    copy(workdir, text, out);
+}
+
+void StupidPreprocessor::copy(const std::filesystem::path &workdir, std::string_view text, LineSink out) {
+    static auto &stops = Stats::counter("preprocessor.early_stops");
+    LineReader in(text);
+    auto r = run(workdir, in, ScanMode::copy, out, {});
+    if (r.cmd == Command::stop) {
+        stops.add();
+        collect_includes(workdir, in.rest());
+    }
+}
 
-}
\ No newline at end of file
+bool StupidPreprocessor::copy_plain(const std::filesystem::path &workdir, std::string_view text, LineSink out) {
+    LineReader in(text);
+    std::string_view ln;
+    bool st;
+    do {
+        st = in.get_line(ln);
+        auto lnv = trim(ln);
+        //any directive, even unknown one, requires the preprocessor
+        if (!lnv.empty() && lnv.front() == '#') return false;
+        if (!out(ln)) {
+            collect_includes(workdir, in.rest());
+            break;
+        }
+    } while (st);
+    return true;
+}
+
+void StupidPreprocessor::collect_includes(const std::filesystem::path &cur_dir, std::string_view text) {
+    //no comments, no conditions, no continuation lines - just lines starting with #include
+    while (!text.empty()) {
+        auto nl = std::min(text.find('\n'), text.size());
+        auto lnv = trim(text.substr(0, nl));
+        text = text.substr(std::min(nl + 1, text.size()));
+        if (lnv.empty() || lnv.front() != '#') continue;
+        auto sep = std::min(lnv.find(' '), lnv.size());
+        if (find(lnv.substr(0, sep)) == Command::_include) {
+            parse_include(cur_dir, trim(lnv.substr(sep)), {});
+        }
+    }
+}
@@ -1,5 +1,7 @@
 export module cairn.preprocess;
 
+import cairn.utils.function_view;
+
 import <span>;
 import <filesystem>;
 import <string>;
@@ -9,17 +11,37 @@ import <unordered_map>;
 import <unordered_set>;
 import <algorithm>;
 import <array>;
+import <memory>;
+import <string_view>;
 
 
 export class StupidPreprocessor {
 public:
 
+    StupidPreprocessor();
+
     void append_includes(std::span<const std::filesystem::path> paths);
     void append_includes(const std::filesystem::path &path);
 
     void define_symbol(std::string symbol, std::string value);
     void undef_symbol(const std::string &symbol);
 
+    ///Makes current macros a shared immutable layer
+    /**
+     * Copies of the preprocessor share the layer and keep only their own changes.
+     * Call it after the predefined macros are set up. Symbols of the macros are
+     * kept by reset_caches(), the instance must not be changed after that
+     */
+    void freeze_macros();
+
+    ///Releases memoized headers and symbols created by copies of the preprocessor
+    /**
+     * Call it between builds (--watch), so edited macros are not kept for the
+     * life of the process. Copies made before keep the previous caches until
+     * they are destroyed. Symbols of the frozen macros are kept
+     */
+    void reset_caches();
+
     enum class ScanMode {
         skip, //skip until #endif - enters all #if , #ifdef, #else
         collect, //collect defines, do not produce output
@@ -38,7 +60,8 @@ public:
         _define,
         _undef,
         _include,        
-        eof
+        eof,
+        stop        //output is no longer needed (the sink returned false)
     };
 
     static constexpr auto strCommand =  std::array<std::string_view, 11>({
@@ -57,16 +80,61 @@ public:
 
     struct NextCommand {
         Command cmd;
-        std::string args;
+        std::string_view args;  ///<valid until next line is read
     };
 
-    NextCommand run(const std::filesystem::path &cur_dir, std::istream &in, ScanMode mode, std::ostream &out, 
+    ///Receives lines of the output. Returns false, when no more lines are needed
+    using LineSink = FunctionView<bool(std::string_view)>;
+
+    NextCommand run(const std::filesystem::path &cur_dir, std::string_view text, ScanMode mode, LineSink out, 
         std::unordered_set<std::filesystem::path> &&disabled_includes = {});
 
 
     std::string run(const std::filesystem::path &workdir, const std::filesystem::path &src_file);
 
+    ///Preprocess the file and pass output lines to the sink
+    /**
+     * When the sink returns false, preprocessing stops. The rest of the file
+     * is only searched for #include directives, so get_included_files() still
+     * lists all files the source depends on (it can list more files, as
+     * conditions are not evaluated there)
+     *
+     * @param workdir working directory
+     * @param src_file source file
+     * @param out receives lines
+     */
+    void run(const std::filesystem::path &workdir, const std::filesystem::path &src_file, LineSink out);
+
+    ///Same as above, for text of the file already loaded by read_source()
+    void copy(const std::filesystem::path &workdir, std::string_view text, LineSink out);
+
+    ///Passes lines to the sink without preprocessing
+    /**
+     * Lines are only stripped of comments and joined with continuations. This is
+     * possible, when no directive appears before the sink returns false (we don't
+     * expand macros in code). The rest of the text is searched for #include as in run()
+     *
+     * @param workdir working directory
+     * @param text text of the file
+     * @param out receives lines
+     * @retval true done, output is the same as from the preprocessing
+     * @retval false a directive was found, the text must be preprocessed by copy().
+     * The sink has already received some lines
+     */
+    bool copy_plain(const std::filesystem::path &workdir, std::string_view text, LineSink out);
+
+    ///Reads whole source file, updates statistics
+    /**
+     * @param p path to the file
+     * @param out receives content
+     * @retval true success
+     * @retval false file can't be opened
+     */
+    static bool read_source(const std::filesystem::path &p, std::string &out);
+
     const auto &get_include_paths() const {return _includes;}
+    ///returns list of files opened by #include
+    const auto &get_included_files() const {return _included;}
 
 
 protected:
@@ -84,24 +152,104 @@ protected:
         white         //whitespace
     };
 
+    ///Token refers to the source line or to the symbol table
     struct Token {
         TokenType type = TokenType::begin;
-        std::string content = {};
+        std::string_view content = {};
+        bool operator==(const Token &) const = default;
     };
 
 
 
+    ///Macro definition. It refers to the symbol table, so it is cheap to copy
     struct MacroDef {
-        std::vector<Token> content;
-        std::optional<std::vector<std::string> > variables;
+        std::span<const Token> content;
+        std::optional<std::span<const std::string_view> > variables;
+        bool operator==(const MacroDef &other) const;
     };
 
+    ///Storage of macro names and definitions shared by copies of the preprocessor
+    class SymbolTable;
+    SymbolTable &symbols() {return *_symbols;}
+
     using IncludeList = std::vector<std::filesystem::path>;
 
-    using MacroMap = std::unordered_map<std::string, MacroDef>;
+    ///Splits text to lines, removes comments and joins continued lines
+    /**
+     * Lines without '/' and '\\' are returned directly from the text (found by memchr),
+     * other lines are processed character by character
+     */
+    class LineReader {
+    public:
+        LineReader(std::string_view text):_text(text) {}
+        ///Read next line
+        /**
+         * @param ln receives the line. It is valid until next call
+         * @retval true line read
+         * @retval false line read, it was the last line
+         */
+        bool get_line(std::string_view &ln);
+        ///Returns unread part of the text
+        std::string_view rest() const {return _text.substr(_pos);}
+    protected:
+        std::string_view _text;
+        std::size_t _pos = 0;
+        std::string _buffer;
+        std::string _pending;
+    };
 
-    MacroMap _context;
+    ///Macro names are keys from the symbol table
+    using MacroMap = std::unordered_map<std::string_view, MacroDef>;
+
+    ///Macro definitions. A frozen base is shared by copies, changes are kept in an overlay
+    class MacroContext {
+    public:
+        const MacroDef *find(std::string_view name) const;
+        ///Define macro, name must be stored in the symbol table
+        void define(std::string_view name, MacroDef def);
+        ///Undefine macro, name must be stored in the symbol table
+        void undef(std::string_view name);
+        ///Merge the overlay into a new shared base
+        void freeze();
+    protected:
+        std::shared_ptr<const MacroMap> _base;
+        std::unordered_map<std::string_view, std::optional<MacroDef> > _overlay;    ///<nullopt - undefined
+    };
+
+    ///Records what processing of a header depends on and what it changes
+    struct Recording {
+        std::unordered_map<std::string, std::optional<MacroDef> > reads;    ///<macros read before written
+        std::unordered_set<std::string> written;                            ///<macros defined or undefined
+        std::unordered_map<std::filesystem::path, bool> include_reads;      ///<includes seen before added, true=was disabled
+        std::unordered_set<std::filesystem::path> disabled;                 ///<includes added to disabled includes
+        std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type> > files; ///<files read (or tried)
+        std::size_t included_start = 0;                                     ///<first item of _included
+    };
+
+    ///Memoized processing of headers, shared by copies of the preprocessor
+    class HeaderCache;
+
+    MacroContext _context;
     IncludeList _includes;
+    IncludeList _included;
+    std::shared_ptr<HeaderCache> _header_cache;
+    std::shared_ptr<SymbolTable> _symbols;
+    std::shared_ptr<SymbolTable> _frozen_symbols;   ///<symbols of the frozen macros
+    std::string _includes_key;          ///<include paths (part of the key of the header cache)
+    std::vector<Recording> _recordings; ///<headers being processed and recorded (nested)
+
+    ///Argument of an expanded function-like macro, tokens are in _arg_tokens
+    struct MacroArg {
+        std::string_view name;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    //buffers of evaluation of conditions, reused to avoid allocations
+    std::vector<Token> _token_stream;
+    std::vector<Token> _arg_tokens;
+    std::vector<MacroArg> _args;
+    std::vector<std::string_view> _deactivated;
 
     static constexpr Command find(std::string_view text) {
         auto iter = std::find(strCommand.begin(), strCommand.end(), text);
@@ -111,23 +259,36 @@ protected:
 
 
 
+    const MacroDef *find_macro(std::string_view name);
+    void note_write(std::string_view name);
+    void note_include(const std::filesystem::path &path, bool disabled);
+    void note_file(const std::filesystem::path &path, std::filesystem::file_time_type tm);
+
     void parse_define(std::string_view args);
     void parse_undef(std::string_view args);
+    NextCommand run(const std::filesystem::path &cur_dir, LineReader &in, ScanMode mode, LineSink out, 
+        std::unordered_set<std::filesystem::path> &&disabled_includes);
     void parse_include(const std::filesystem::path &cur_dir, std::string_view args, 
         std::unordered_set<std::filesystem::path> &&disabled_includes);
+    bool replay_header(const std::string &key, std::unordered_set<std::filesystem::path> &disabled_includes);
+    void collect_includes(const std::filesystem::path &cur_dir, std::string_view text);
     bool parse_if(std::string_view args);
     bool parse_ifdef(std::string_view args);
 
-    template<typename Fn>
-    static auto tokenizer(Fn &&fn);
-
-
     static auto tokenizer_from_stream(std::span<const Token> stream);
     static auto tokenizer_from_string(std::string_view str);
+    auto tokenizer_from_args(std::size_t begin, std::size_t end);
 
 
+    ///Expands macros, result is appended to _token_stream
+    /**
+     * @param next_token source of tokens
+     * @param args_begin first argument of the expanded macro (index to _args)
+     * @param args_end end of arguments of the expanded macro
+     * @param cond expand defined()
+     */
     template<typename Fn>
-    void preproc_line(Fn &&next_token, std::vector<Token> &token_stream, const MacroMap &arguments, std::unordered_set<std::string> &deactivated, bool cond) const;
+    void preproc_line(Fn &&next_token, std::size_t args_begin, std::size_t args_end, bool cond);
 
     long evaluate(auto &&next_token);
     std::pair<long, Token> evaluate_oror(auto &&next_token);
@@ -0,0 +1,386 @@
+export module cairn.remote.executor;
+
+import cairn.abstract_compiler;
+import cairn.remote.protocol;
+import cairn.utils.hash;
+import cairn.utils.log;
+import cairn.utils.stats;
+
+import <algorithm>;
+import <array>;
+import <chrono>;
+import <cstdint>;
+import <filesystem>;
+import <fstream>;
+import <functional>;
+import <iostream>;
+import <iterator>;
+import <memory>;
+import <mutex>;
+import <optional>;
+import <span>;
+import <string>;
+import <string_view>;
+import <thread>;
+import <unordered_map>;
+import <unordered_set>;
+import <vector>;
+
+
+///Distributes compilations to remote workers (cairn-worker)
+/**
+ * Every worker is connected by a single connection (session). Files needed by
+ * the compilation (source, textual includes and imported BMIs) are sent as blobs
+ * identified by hash of the content and every blob is sent to the worker only
+ * once per session.
+ *
+ * Paths inside of roots (project directory, build directory) are mirrored into
+ * a sandbox on the worker and command lines are rewritten accordingly. Other
+ * paths (system headers) are not sent, they must exist on the worker. The
+ * worker executes its own compiler. Commands, which the worker would refuse
+ * (see find_refused_argument), are executed locally.
+ */
+export class RemoteExecutor {
+public:
+
+    struct Job {
+        AbstractCompiler::Invocation invocation;
+        std::vector<std::filesystem::path> inputs;  ///<files required by the compilation
+        AbstractCompiler::CompileResult outputs;    ///<expected outputs
+    };
+
+    using Callback = std::function<void(int status, const AbstractCompiler::CompileResult &result)>;
+    ///Executes the job locally, it is called instead of the callback, when the worker disconnects
+    using Fallback = std::function<void()>;
+
+    ///Connect workers
+    /**
+     * @param workers list of addresses (host:port). Unavailable workers are skipped
+     * @param roots directories mirrored to the workers
+     * @param secret shared secret of the workers
+     */
+    RemoteExecutor(std::span<const std::string> workers, std::vector<std::filesystem::path> roots,
+                   const std::string &secret);
+    ~RemoteExecutor();
+    RemoteExecutor(const RemoteExecutor &) = delete;
+    RemoteExecutor &operator=(const RemoteExecutor &) = delete;
+
+    ///Total count of slots of connected workers
+    unsigned int get_slots() const;
+
+    ///Execute the job on a worker, which has a free slot
+    /**
+     * @param job job to execute
+     * @param cb callback called when the job is done (from a different thread)
+     * @param local called instead of the callback, if the worker disconnects
+     * before the job is done
+     * @retval true job has been sent
+     * @retval false no free slot, or the job cannot be executed remotely. The
+     * caller should execute the job locally
+     */
+    bool execute(Job &&job, Callback &&cb, Fallback &&local);
+
+    ///Log count of remote jobs
+    void report() const;
+
+protected:
+
+    struct Pending {
+        Callback cb;
+        Fallback local;
+        AbstractCompiler::CompileResult outputs;
+    };
+
+    struct Worker {
+        std::string address;
+        std::string name;
+        std::optional<Connection> conn;
+        unsigned int slots = 0;
+        //following fields are guarded by RemoteExecutor::_mx
+        bool alive = false;
+        unsigned int in_flight = 0;
+        std::unordered_map<std::uint64_t, Pending> pending;
+        //blobs and the job must be sent together (blob must arrive before the job)
+        std::mutex send_mx;
+        std::unordered_set<std::uint64_t> sent;
+        std::thread reader;
+    };
+
+    std::vector<std::unique_ptr<Worker> > _workers;
+    std::vector<std::filesystem::path> _roots;
+    mutable std::mutex _mx;
+    std::uint64_t _next_id = 1;
+    std::mutex _hash_mx;
+    ///memo of hashes, keyed by the stamp of the file (files change between builds in --watch)
+    std::unordered_map<std::filesystem::path, AbstractCompiler::FileStamp> _file_hashes;
+
+    bool is_mirrored(const std::filesystem::path &p) const;
+    std::uint64_t file_hash(const std::filesystem::path &file);
+    void send_job(Worker &w, std::uint64_t id, const Job &job);
+    void reader(Worker &w);
+    void disconnect(Worker &w, std::string_view reason);
+};
+
+static std::string read_file(const std::filesystem::path &file) {
+    std::ifstream in(file, std::ios::in|std::ios::binary);
+    if (!in) throw std::runtime_error("Remote: can't read file: " + file.string());
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+///phase names must be static strings
+static std::string_view static_phase_name(std::string_view name) {
+    static constexpr std::array<std::string_view, 3> known = {"bmi", "object", "compile"};
+    auto iter = std::find(known.begin(), known.end(), name);
+    return iter == known.end()?std::string_view("remote"):*iter;
+}
+
+RemoteExecutor::RemoteExecutor(std::span<const std::string> workers, std::vector<std::filesystem::path> roots,
+                               const std::string &secret)
+    :_roots(std::move(roots)) {
+    MsgHello hello;
+    for (auto &r: _roots) r = r.lexically_normal();
+    hello.roots = _roots;
+    for (const auto &addr: workers) {
+        auto w = std::make_unique<Worker>();
+        w->address = addr;
+        try {
+            w->conn.emplace(Connection::connect(addr));
+            w->conn->send(MsgType::hello, hello);
+            if (w->conn->receive() != MsgType::challenge) throw std::runtime_error("unexpected response");
+            MsgChallenge challenge;
+            w->conn->read_header(challenge);
+            w->conn->read_payload();
+            if (challenge.version != remote_protocol_version) throw std::runtime_error("incompatible version of the worker");
+            w->conn->send(MsgType::auth, MsgAuth{hmac_sha256(secret, challenge.nonce)});
+            auto t = w->conn->receive();
+            if (!t) throw std::runtime_error("authentication failed (check --secret)");
+            if (t != MsgType::welcome) throw std::runtime_error("unexpected response");
+            MsgWelcome welcome;
+            w->conn->read_header(welcome);
+            w->conn->read_payload();
+            w->name = welcome.name;
+            w->slots = std::max<unsigned int>(1, welcome.slots);
+            w->alive = true;
+            Log::verbose("Remote: connected worker {} ({}), {} slots, compiler {}", addr, w->name, w->slots, welcome.compiler);
+            w->reader = std::thread([this, w = w.get()]{reader(*w);});
+            _workers.push_back(std::move(w));
+        } catch (const std::exception &e) {
+            Log::warning("Remote: worker {} is not available: {}", addr, e.what());
+        }
+    }
+}
+
+RemoteExecutor::~RemoteExecutor() {
+    for (auto &w: _workers) {
+        w->conn->shutdown();
+        if (w->reader.joinable()) w->reader.join();
+    }
+}
+
+unsigned int RemoteExecutor::get_slots() const {
+    std::lock_guard _(_mx);
+    unsigned int s = 0;
+    for (const auto &w: _workers) if (w->alive) s += w->slots;
+    return s;
+}
+
+bool RemoteExecutor::is_mirrored(const std::filesystem::path &p) const {
+    auto n = p.lexically_normal();
+    return std::any_of(_roots.begin(), _roots.end(), [&](const std::filesystem::path &r){
+        auto rel = n.lexically_relative(r);
+        return !rel.empty() && *rel.begin() != "..";
+    });
+}
+
+std::uint64_t RemoteExecutor::file_hash(const std::filesystem::path &file) {
+    std::error_code ec;
+    auto sz = std::filesystem::file_size(file, ec);
+    if (ec) return 0;
+    auto mtime = static_cast<std::int64_t>(std::filesystem::last_write_time(file, ec).time_since_epoch().count());
+    if (ec) return 0;
+    {
+        std::lock_guard _(_hash_mx);
+        auto iter = _file_hashes.find(file);
+        if (iter != _file_hashes.end() && iter->second.size == sz && iter->second.mtime == mtime) {
+            return iter->second.hash;
+        }
+    }
+    auto h = hash_file(file);
+    std::lock_guard _(_hash_mx);
+    _file_hashes[file] = {sz, mtime, h};
+    return h;
+}
+
+bool RemoteExecutor::execute(Job &&job, Callback &&cb, Fallback &&local) {
+    static auto &cnt_jobs = Stats::counter("remote.jobs");
+    const auto &inv = job.invocation;
+    if (!is_mirrored(inv.workdir)) return false;
+    for (const auto *o: {&job.outputs.interface, &job.outputs.object}) {
+        if (!o->empty() && !is_mirrored(*o)) return false;
+    }
+    //the worker refuses such commands (system paths, plugins), they are compiled locally
+    for (const auto &c: inv.commands) {
+        auto refused = find_refused_argument(c.arguments, inv.workdir, [&](const std::filesystem::path &p){
+            return is_mirrored(p);
+        });
+        if (refused) {
+            Log::debug("Remote: compiled locally, argument can't be sent to workers: {}", [&]{
+                const auto &a = c.arguments[*refused];
+                return std::string(a.begin(), a.end());
+            });
+            return false;
+        }
+    }
+
+    Worker *w = nullptr;
+    std::uint64_t id;
+    {
+        std::lock_guard _(_mx);
+        for (auto &x: _workers) {
+            if (!x->alive || x->in_flight >= x->slots) continue;
+            //least loaded worker (relative to its slots)
+            if (!w || x->in_flight * w->slots < w->in_flight * x->slots) w = x.get();
+        }
+        if (!w) return false;
+        id = _next_id++;
+        ++w->in_flight;
+        w->pending.emplace(id, Pending{std::move(cb), std::move(local), job.outputs});
+    }
+    try {
+        send_job(*w, id, job);
+    } catch (const std::exception &e) {
+        //the job is returned to the caller, it will be executed locally
+        {
+            std::lock_guard _(_mx);
+            w->pending.erase(id);
+            --w->in_flight;
+        }
+        disconnect(*w, e.what());
+        return false;
+    }
+    cnt_jobs.add();
+    return true;
+}
+
+void RemoteExecutor::send_job(Worker &w, std::uint64_t id, const Job &job) {
+    static auto &cnt_sent = Stats::counter("remote.blobs_sent");
+    static auto &cnt_reused = Stats::counter("remote.blobs_reused");
+    MsgJob msg;
+    msg.id = id;
+    msg.workdir = job.invocation.workdir;
+    for (const auto &c: job.invocation.commands) {
+        if (!c.arguments.empty()) msg.commands.push_back({std::string(c.phase), c.arguments});
+    }
+    for (const auto *o: {&job.outputs.interface, &job.outputs.object}) {
+        if (!o->empty()) msg.outputs.push_back(*o);
+    }
+    for (const auto &i: job.inputs) {
+        //system headers are not mirrored, the worker has its own
+        if (!is_mirrored(i)) continue;
+        auto h = file_hash(i);
+        if (!h) throw std::runtime_error("can't read file: " + i.string());
+        msg.inputs.push_back({i, h});
+    }
+    std::lock_guard _(w.send_mx);
+    for (const auto &i: msg.inputs) {
+        if (!w.sent.insert(i.hash).second) {
+            cnt_reused.add();
+            continue;
+        }
+        w.conn->send(MsgType::blob, MsgBlob{i.hash}, read_file(i.path));
+        cnt_sent.add();
+    }
+    Log::debug("Remote: {} -> {}", [&]{return job.invocation.workdir.string();}, w.address);
+    w.conn->send(MsgType::job, msg);
+}
+
+void RemoteExecutor::reader(Worker &w) {
+    try {
+        while (auto t = w.conn->receive()) {
+            if (*t != MsgType::result) throw std::runtime_error("unexpected message");
+            MsgResult res;
+            w.conn->read_header(res);
+            auto payload = w.conn->read_payload();
+            Pending p;
+            {
+                std::lock_guard _(_mx);
+                auto iter = w.pending.find(res.id);
+                if (iter == w.pending.end()) throw std::runtime_error("unknown job");
+                p = std::move(iter->second);
+                w.pending.erase(iter);
+                --w.in_flight;
+            }
+            if (!res.log.empty()) std::cerr << res.log << std::flush;
+            auto &result = p.outputs;
+            int status = res.status;
+            if (status) {
+                Log::error("Remote: compilation failed on worker {}: {}", w.address,
+                        (result.object.empty()?result.interface:result.object).string());
+            } else {
+                std::size_t pos = 0;
+                std::size_t idx = 0;
+                for (auto *o: {&result.interface, &result.object}) {
+                    if (o->empty()) continue;
+                    if (idx >= res.output_sizes.size() || pos + res.output_sizes[idx] > payload.size()) {
+                        Log::error("Remote: worker {} didn't return {}", w.address, o->string());
+                        status = -1;
+                        break;
+                    }
+                    AbstractCompiler::ensure_path_exists(*o);
+                    std::ofstream out(*o, std::ios::out|std::ios::trunc|std::ios::binary);
+                    out.write(payload.data() + pos, static_cast<std::streamsize>(res.output_sizes[idx]));
+                    if (!out) {
+                        Log::error("Remote: failed to write {}", o->string());
+                        status = -1;
+                        break;
+                    }
+                    pos += static_cast<std::size_t>(res.output_sizes[idx]);
+                    ++idx;
+                }
+            }
+            //phases were executed on the worker, they are placed to end before now
+            auto tp = std::chrono::steady_clock::now();
+            result.phases.resize(res.phases.size());
+            for (std::size_t i = res.phases.size(); i-- > 0;) {
+                const auto &ph = res.phases[i];
+                auto start = tp - std::chrono::microseconds(ph.duration_us);
+                result.phases[i] = {static_phase_name(ph.phase), start, tp, ph.status};
+                tp = start;
+            }
+            p.cb(status, result);
+        }
+        disconnect(w, "connection closed");
+    } catch (const std::exception &e) {
+        disconnect(w, e.what());
+    }
+}
+
+void RemoteExecutor::disconnect(Worker &w, std::string_view reason) {
+    std::unordered_map<std::uint64_t, Pending> pending;
+    {
+        std::lock_guard _(_mx);
+        if (!w.alive) return;
+        w.alive = false;
+        w.in_flight = 0;
+        std::swap(pending, w.pending);
+    }
+    w.conn->shutdown();
+    if (pending.empty()) return;
+    Log::warning("Remote: worker {} disconnected: {}. {} jobs are compiled locally", w.address, reason, pending.size());
+    for (auto &[id, p]: pending) {
+        try {
+            p.local();
+        } catch (const std::exception &e) {
+            Log::error("EXCEPTION: {}", e.what());
+            p.cb(-1, p.outputs);
+        }
+    }
+}
+
+void RemoteExecutor::report() const {
+    auto jobs = Stats::counter("remote.jobs").value();
+    if (jobs) {
+        Log::verbose("Remote: {} jobs, {} files sent, {} files reused",
+                jobs, Stats::counter("remote.blobs_sent").value(), Stats::counter("remote.blobs_reused").value());
+    }
+}
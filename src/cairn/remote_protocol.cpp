@@ -0,0 +1,470 @@
+module;
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+export module cairn.remote.protocol;
+
+import cairn.utils.arguments;
+import cairn.utils.fd_streambuf;
+import cairn.utils.serializer;
+import cairn.utils.serializer.rules;
+import cairn.utils.stats;
+
+import <cstdint>;
+import <filesystem>;
+import <functional>;
+import <iostream>;
+import <memory>;
+import <mutex>;
+import <optional>;
+import <span>;
+import <stdexcept>;
+import <string>;
+import <string_view>;
+import <system_error>;
+import <utility>;
+import <vector>;
+
+///Default TCP port of cairn-worker
+export constexpr std::uint16_t default_worker_port = 7590;
+
+///Version of the protocol, client and worker must match
+export constexpr std::uint32_t remote_protocol_version = 2;
+
+///Type of a message
+export enum class MsgType : std::uint8_t {
+    hello,          ///<client->worker: start of the session
+    challenge,      ///<worker->client: response to hello, the client must authenticate
+    auth,           ///<client->worker: response to the challenge
+    welcome,        ///<worker->client: the client has been authenticated
+    blob,           ///<client->worker: content of a file (payload) identified by hash
+    job,            ///<client->worker: execute compilation
+    result          ///<worker->client: result of the compilation (payload contains outputs)
+};
+
+export struct MsgHello {
+    std::uint32_t version = remote_protocol_version;
+    ///directories of the client, which are mirrored to the worker's sandbox
+    std::vector<std::filesystem::path> roots;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.version, me.roots);
+    }
+};
+
+export struct MsgChallenge {
+    std::uint32_t version = remote_protocol_version;
+    std::string nonce;          ///<random data, generated for every session
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.version, me.nonce);
+    }
+};
+
+export struct MsgAuth {
+    std::string response;       ///<hmac_sha256(secret, nonce)
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.response);
+    }
+};
+
+export struct MsgWelcome {
+    std::string name;           ///<name of the worker (host name)
+    std::string compiler;       ///<the compiler executed by the worker
+    std::uint32_t slots = 1;    ///<count of parallel compilations
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.name, me.compiler, me.slots);
+    }
+};
+
+export struct MsgBlob {
+    std::uint64_t hash = 0;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.hash);
+    }
+};
+
+export struct JobCommand {
+    std::string phase;
+    std::vector<ArgumentString> arguments;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.phase, me.arguments);
+    }
+};
+
+export struct JobInput {
+    std::filesystem::path path;     ///<path on the client
+    std::uint64_t hash = 0;         ///<content (sent as blob before)
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.path, me.hash);
+    }
+};
+
+export struct MsgJob {
+    std::uint64_t id = 0;
+    std::filesystem::path workdir;
+    std::vector<JobCommand> commands;
+    std::vector<JobInput> inputs;
+    std::vector<std::filesystem::path> outputs;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.id, me.workdir, me.commands, me.inputs, me.outputs);
+    }
+};
+
+export struct ResultPhase {
+    std::string phase;
+    std::uint64_t duration_us = 0;
+    std::int32_t status = 0;
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.phase, me.duration_us, me.status);
+    }
+};
+
+export struct MsgResult {
+    std::uint64_t id = 0;
+    std::int32_t status = 0;
+    std::string log;                            ///<output of the compiler (stderr)
+    std::vector<ResultPhase> phases;
+    std::vector<std::uint64_t> output_sizes;    ///<sizes of outputs in the payload (in order of the job)
+
+    template<typename Me, typename Arch>
+    static void serialize(Me &me, Arch &arch) {
+        arch(me.id, me.status, me.log, me.phases, me.output_sizes);
+    }
+};
+
+///Find an argument, which a worker refuses to execute
+/**
+ * The worker runs command lines of authenticated clients, but everything the
+ * compiler reads or writes must stay in the session's sandbox. Refused are
+ * flags, which load code into the compiler or run other programs, response
+ * files, absolute paths outside of the sandbox and outputs, which resolve
+ * outside of the sandbox.
+ *
+ * @param args arguments of the command
+ * @param workdir working directory, relative outputs are resolved against it
+ * @param allowed returns true, if the (absolute, normalized) path is inside of the sandbox
+ * @return index of the refused argument, or nullopt, if the command can be executed
+ */
+export std::optional<std::size_t> find_refused_argument(std::span<const ArgumentString> args,
+                        const std::filesystem::path &workdir,
+                        const std::function<bool(const std::filesystem::path &)> &allowed);
+
+///Framed message connection over a TCP socket
+/**
+ * Every message consists of the type, the header (serialized structure) and
+ * the binary payload. Sending is thread safe, receiving must be done by a
+ * single thread
+ */
+export class Connection {
+public:
+
+    ///Connect to a worker
+    /**
+     * @param address host:port or host (default port is used)
+     * @exception std::system_error connection failed
+     */
+    static Connection connect(std::string_view address);
+
+    explicit Connection(int fd);
+    Connection(Connection &&) = default;
+
+    template<typename T>
+    void send(MsgType type, const T &header, std::string_view payload = {}) {
+        static auto &cnt = Stats::counter("remote.bytes_sent", Stats::Unit::bytes);
+        std::lock_guard _(*_send_mx);
+        _out->put(static_cast<char>(type));
+        serialize_to_stream(*_out, header);
+        std::uint64_t sz = payload.size();
+        serialize_to_stream(*_out, sz);
+        _out->write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        _out->flush();
+        if (!*_out) throw std::runtime_error("Remote: connection lost");
+        cnt.add(payload.size());
+    }
+
+    ///Receive type of next message
+    /**
+     * The caller must read header and payload of the message
+     * @return type of the message, or nullopt if the connection has been closed
+     */
+    std::optional<MsgType> receive() {
+        auto c = _in->get();
+        if (c == std::char_traits<char>::eof()) return std::nullopt;
+        return static_cast<MsgType>(c);
+    }
+
+    template<typename T>
+    void read_header(T &header) {
+        deserialize_from_stream(*_in, header);
+    }
+
+    std::string read_payload() {
+        static auto &cnt = Stats::counter("remote.bytes_received", Stats::Unit::bytes);
+        std::uint64_t sz;
+        deserialize_from_stream(*_in, sz);
+        std::string data(static_cast<std::size_t>(sz), '\0');
+        _in->read(data.data(), static_cast<std::streamsize>(sz));
+        if (static_cast<std::uint64_t>(_in->gcount()) != sz) throw std::runtime_error("Remote: unexpected end of stream");
+        cnt.add(data.size());
+        return data;
+    }
+
+    ///Close the connection for both directions (unblocks the receiving thread)
+    void shutdown();
+
+protected:
+    int _fd;
+    std::unique_ptr<fd_streambuf> _in_buf;
+    std::unique_ptr<fd_streambuf> _out_buf;
+    std::unique_ptr<std::istream> _in;
+    std::unique_ptr<std::ostream> _out;
+    std::unique_ptr<std::mutex> _send_mx;
+};
+
+///Listening socket of the worker
+export class Listener {
+public:
+    ///Listen on address
+    /**
+     * @param address [host:]port. Without host, it listens on the loopback
+     * interface only (127.0.0.1)
+     */
+    explicit Listener(std::string_view address);
+    ~Listener();
+    Listener(const Listener &) = delete;
+    Listener &operator=(const Listener &) = delete;
+
+    ///Returns true, if the socket is bound to a loopback address
+    bool is_loopback() const;
+
+    ///Wait for a connection
+    Connection accept();
+
+protected:
+    int _fd = -1;
+};
+
+///Split address to host and port (default port if missing)
+static std::pair<std::string, std::string> split_address(std::string_view address) {
+    auto sep = address.rfind(':');
+    if (sep == address.npos || address.find(']', sep) != address.npos) {
+        return {std::string(address), std::to_string(default_worker_port)};
+    }
+    auto host = address.substr(0, sep);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') host = host.substr(1, host.size()-2);
+    return {std::string(host), std::string(address.substr(sep+1))};
+}
+
+///flags, which load code into the compiler, run other programs or pass arguments to them
+static constexpr std::string_view refused_flags[] = {
+    "-fplugin", "-fpass-plugin", "-load", "-plugin", "-add-plugin", "-B", "--prefix",
+    "-wrapper", "-specs", "--specs", "-save-temps", "-Wp,", "-Wa,", "-Wl,",
+    "-Xpreprocessor", "-Xassembler", "-Xlinker", "/B1", "/B2", "/Bx", "/analyze:plugin"
+};
+
+///flags, which write to a path (value is joined or the next argument)
+static constexpr std::string_view output_flags[] = {
+    "-o", "-MF", "-MJ", "-dumpdir", "-fmodule-output=", "-fmodule-mapper=", "-ftime-trace=",
+    "/Fo", "/Fe", "/Fd", "/Fp", "/Fa", "/Fm", "/Fi", "/FR", "/Fr", "/ifcOutput", "/sourceDependencies"
+};
+
+///flags, which take a joined path (paths after '=' and ',' are checked always)
+static constexpr std::string_view path_flags[] = {
+    "-I", "-L", "-F", "-iquote", "-isystem", "-idirafter", "-include", "-imacros",
+    "-iprefix", "-iwithprefix", "-iwithprefixbefore", "-isysroot", "-imsvc", "/I", "/FI"
+};
+
+std::optional<std::size_t> find_refused_argument(std::span<const ArgumentString> args,
+                        const std::filesystem::path &workdir,
+                        const std::function<bool(const std::filesystem::path &)> &allowed) {
+    auto is_allowed = [&](const ArgumentString &value, bool output) {
+        std::filesystem::path p(value);
+        if (p.is_absolute()) return allowed(p.lexically_normal());
+        //relative inputs are resolved by the compiler against its own search paths
+        return !output || allowed((workdir/p).lexically_normal());
+    };
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const auto &arg = args[i];
+        std::string flag(arg.begin(), arg.end());
+        if (flag.starts_with('@')) return i;
+        for (auto f: refused_flags) if (flag.starts_with(f)) return i;
+        for (auto f: output_flags) {
+            if (!flag.starts_with(f)) continue;
+            if (flag.size() > f.size()) {
+                if (f == "-fmodule-mapper=" && flag[f.size()] == '|') return i;
+                if (!is_allowed(arg.substr(f.size()), true)) return i;
+            } else if (i + 1 < args.size()) {
+                if (!is_allowed(args[i+1], true)) return i;
+                ++i;
+            }
+            break;
+        }
+        //absolute paths anywhere in the argument
+        if (!is_allowed(arg, false)) return i;
+        for (auto f: path_flags) {
+            if (flag.starts_with(f) && !is_allowed(arg.substr(f.size()), false)) return i;
+        }
+        for (std::size_t pos = 0; pos < arg.size(); ++pos) {
+            if ((arg[pos] == '=' || arg[pos] == ',') && !is_allowed(arg.substr(pos+1), false)) return i;
+        }
+    }
+    return std::nullopt;
+}
+
+Connection::Connection(int fd)
+    :_fd(fd)
+    ,_in_buf(std::make_unique<fd_streambuf>(fd, true))
+    ,_out_buf(std::make_unique<fd_streambuf>(fd, false))
+    ,_in(std::make_unique<std::istream>(_in_buf.get()))
+    ,_out(std::make_unique<std::ostream>(_out_buf.get()))
+    ,_send_mx(std::make_unique<std::mutex>()) {}
+
+#ifdef _WIN32
+
+Connection Connection::connect(std::string_view) {
+    throw std::runtime_error("Remote compilation is not supported on this platform");
+}
+void Connection::shutdown() {}
+Listener::Listener(std::string_view) {
+    throw std::runtime_error("Remote compilation is not supported on this platform");
+}
+Listener::~Listener() {}
+bool Listener::is_loopback() const {return true;}
+Connection Listener::accept() {
+    throw std::runtime_error("Remote compilation is not supported on this platform");
+}
+
+#else
+
+static void ignore_sigpipe() {
+    //writing to closed socket must not kill the process
+    [[maybe_unused]] static bool _ = []{::signal(SIGPIPE, SIG_IGN);return true;}();
+}
+
+static void set_nodelay(int fd) {
+    int flag = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+Connection Connection::connect(std::string_view address) {
+    ignore_sigpipe();
+    auto [host, port] = split_address(address);
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *res = nullptr;
+    int r = ::getaddrinfo(host.empty()?"localhost":host.c_str(), port.c_str(), &hints, &res);
+    if (r) throw std::runtime_error(std::string("Remote: unable to resolve ")
+                                    .append(address).append(": ").append(gai_strerror(r)));
+    int err = 0;
+    for (auto a = res; a; a = a->ai_next) {
+        int fd = ::socket(a->ai_family, a->ai_socktype | SOCK_CLOEXEC, a->ai_protocol);
+        if (fd < 0) {err = errno; continue;}
+        if (::connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+            ::freeaddrinfo(res);
+            set_nodelay(fd);
+            return Connection(fd);
+        }
+        err = errno;
+        ::close(fd);
+    }
+    ::freeaddrinfo(res);
+    throw std::system_error(err, std::system_category(), std::string("Remote: unable to connect ").append(address));
+}
+
+void Connection::shutdown() {
+    ::shutdown(_fd, SHUT_RDWR);
+}
+
+Listener::Listener(std::string_view address) {
+    ignore_sigpipe();
+    auto [host, port] = split_address(address);
+    if (address.find(':') == address.npos) {
+        //only port - the worker is not accessible from the network by default
+        port = host;
+        host = "127.0.0.1";
+    }
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo *res = nullptr;
+    int r = ::getaddrinfo(host.empty()?nullptr:host.c_str(), port.c_str(), &hints, &res);
+    if (r) throw std::runtime_error(std::string("Worker: invalid address ")
+                                    .append(address).append(": ").append(gai_strerror(r)));
+    int err = 0;
+    for (auto a = res; a; a = a->ai_next) {
+        int fd = ::socket(a->ai_family, a->ai_socktype | SOCK_CLOEXEC, a->ai_protocol);
+        if (fd < 0) {err = errno; continue;}
+        int flag = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
+        if (::bind(fd, a->ai_addr, a->ai_addrlen) == 0 && ::listen(fd, 16) == 0) {
+            _fd = fd;
+            break;
+        }
+        err = errno;
+        ::close(fd);
+    }
+    ::freeaddrinfo(res);
+    if (_fd < 0) throw std::system_error(err, std::system_category(), std::string("Worker: unable to listen on ").append(address));
+}
+
+Listener::~Listener() {
+    if (_fd >= 0) ::close(_fd);
+}
+
+bool Listener::is_loopback() const {
+    sockaddr_storage addr = {};
+    socklen_t len = sizeof(addr);
+    if (::getsockname(_fd, reinterpret_cast<sockaddr *>(&addr), &len)) return false;
+    if (addr.ss_family == AF_INET) {
+        auto a = ntohl(reinterpret_cast<const sockaddr_in &>(addr).sin_addr.s_addr);
+        return (a >> 24) == 127;
+    }
+    if (addr.ss_family == AF_INET6) {
+        return IN6_IS_ADDR_LOOPBACK(&reinterpret_cast<const sockaddr_in6 &>(addr).sin6_addr);
+    }
+    return false;
+}
+
+Connection Listener::accept() {
+    while (true) {
+        int fd = ::accept4(_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd >= 0) {
+            set_nodelay(fd);
+            return Connection(fd);
+        }
+        if (errno != EINTR && errno != ECONNABORTED) {
+            throw std::system_error(errno, std::system_category(), "Worker: accept failed");
+        }
+    }
+}
+
+#endif
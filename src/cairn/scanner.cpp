@@ -5,6 +5,8 @@ import <algorithm>;
 import <string>;
 import <vector>;
 import <filesystem>;
+import <tuple>;
+import <utility>;
 
 export class SourceScanner {
 public:
@@ -20,14 +22,42 @@ public:
         ModuleType type = ModuleType::source;
         std::vector<Reference> required;  //list of logical names of required modules (partitions are FQN)
         std::vector<Reference> exported; //list of logical names of exported modules (must be also included as required)
+        std::vector<std::filesystem::path> includes; //files included textually (filled by the compiler, if known)
     };
 
 
     static Info scan_string(std::string_view text);
 
+    ///Collects preprocessed source line by line until the module preamble is complete
+    /**
+     * The scanner stops at first declaration after the module declaration
+     * (or after the first named import) and imports. Once such line is
+     * seen (and the scanner confirms, that it stops there), rest of the
+     * source can't change the result and doesn't need to be preprocessed.
+     * A source, which starts by a declaration without "module;" before it,
+     * is a plain translation unit and it ends there.
+     */
+    class Preamble {
+    public:
+        ///Add line
+        /**
+         * @param line line of preprocessed source (without newline)
+         * @retval true more lines are needed
+         * @retval false preamble is complete
+         */
+        bool add_line(std::string_view line);
+        ///Scan collected lines
+        Info result() const {return scan_string(_text);}
+    protected:
+        std::string _text;
+        bool _in_preamble = false;      //scanner is past the module declaration or first named import
+        bool _global_fragment = false;  //source starts with "module;"
+        std::size_t _next_check = 0;    //don't scan again until the text reaches this size
+    };
+
 protected:
 
-    static Info scan_string_2(std::string_view text);
+    static Info scan_string_2(std::string_view text, bool &complete);
 
 
 };
@@ -206,7 +236,8 @@ void uniq(auto &) {
 
 SourceScanner::Info SourceScanner::scan_string(const std::string_view text) {
 
-    auto r = scan_string_2(text);
+    bool complete;
+    auto r = scan_string_2(text, complete);
     uniq(r.exported);
     uniq(r.required);
     return r;
@@ -233,9 +264,10 @@ static inline bool is_paritition(std::string_view name) {
     return name.find(':') != name.npos;
 }
 
-SourceScanner::Info SourceScanner::scan_string_2(const std::string_view text) {
+SourceScanner::Info SourceScanner::scan_string_2(const std::string_view text, bool &complete) {
 
     Info nfo;
+    complete = false;
 
     auto tkn = simple_tokenizer(text);
     bool cont;
@@ -306,6 +338,7 @@ SourceScanner::Info SourceScanner::scan_string_2(const std::string_view text) {
                     nfo.exported.push_back(nfo.required.back());                
                 }                 
             } else if (s.type == TokenType::keyword) {
+                complete = true;
                 return nfo ; //anything else - exit now, import section ended
             }
         }
@@ -314,3 +347,43 @@ SourceScanner::Info SourceScanner::scan_string_2(const std::string_view text) {
     } while (true);
 
 }
+
+static bool is_keyword_char(char c) {
+    return std::isalnum(c) || c == '_' || c == ':' || c == '.';
+}
+
+//returns first keyword of the text and the text after it
+static std::pair<std::string_view, std::string_view> first_word(std::string_view text) {
+    std::size_t b = 0;
+    while (b < text.size() && std::isspace(text[b])) ++b;
+    std::size_t e = b;
+    while (e < text.size() && is_keyword_char(text[e])) ++e;
+    return {text.substr(b, e - b), text.substr(e)};
+}
+
+bool SourceScanner::Preamble::add_line(std::string_view line) {
+    _text.append(line);
+    _text.push_back('\n');
+    auto [w, rest] = first_word(line);
+    if (!_in_preamble) {
+        if (w == "export") std::tie(w, rest) = first_word(rest);
+        if (w == "module" || w == "import") {
+            auto name = first_word(rest).first;
+            _in_preamble = !name.empty();
+            //"module;" opens the global module fragment, included declarations follow
+            if (w == "module" && name.empty()) _global_fragment = true;
+            return true;
+        }
+        //a declaration before any module declaration - plain translation unit,
+        //which must not be followed by a module declaration (imports are expected above it)
+        return w.empty() || _global_fragment;
+    }
+    if (w.empty() || w == "export" || w == "import") return true;
+    //the scanner should stop at this line, unless it is inside of a bracket or a string
+    if (_text.size() < _next_check) return true;
+    bool complete;
+    scan_string_2(_text, complete);
+    if (complete) return false;
+    _next_check = _text.size() * 2;
+    return true;
+}
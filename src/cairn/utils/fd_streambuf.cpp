@@ -16,6 +16,7 @@ module;
 export module cairn.utils.fd_streambuf;
 import <streambuf>;
 import <vector>;
+import <utility>;
 
 
 // Jednoduchý, přenositelný streambuf pro file descriptor
@@ -69,6 +70,17 @@ public:
         }
     }
 
+    ///Release ownership of the descriptor
+    /**
+     * @return descriptor. The caller is responsible to close it. Content of 
+     * buffers is not affected
+     */
+    FD release() {
+        sync();
+        owner_ = false;
+        return std::exchange(fd_, invalid_fd);
+    }
+
 protected:    
 
     // === čtení (input) ===
@@ -0,0 +1,240 @@
+module;
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+export module cairn.utils.file_watcher;
+
+import cairn.utils.log;
+import cairn.utils.stats;
+
+import <algorithm>;
+import <chrono>;
+import <cstdint>;
+import <filesystem>;
+import <span>;
+import <string>;
+import <system_error>;
+import <thread>;
+import <unordered_map>;
+import <unordered_set>;
+import <vector>;
+
+
+///Watches files and directories for changes (cairn --watch)
+/**
+ * On Linux, inotify is used. Parent directories of watched files are watched
+ * (editors often replace the file by rename, which a watch on the file itself
+ * doesn't survive) and events are filtered by name.
+ *
+ * On other platforms, last write times are polled.
+ *
+ * Files which don't exist (yet) are watched as well, their creation is reported
+ * as a change
+ */
+export class FileWatcher {
+public:
+
+    FileWatcher();
+    ~FileWatcher();
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+
+    ///Replace set of watched paths
+    /**
+     * @param files files to watch. Change of the content, creation or removal is reported
+     * @param directories directories to watch. Creation, removal or rename of
+     * an entry is reported as change of the directory
+     */
+    void watch(std::span<const std::filesystem::path> files,
+               std::span<const std::filesystem::path> directories);
+
+    ///Wait for changes
+    /**
+     * Blocks until at least one change is detected. Then it collects other changes
+     * until there is no change for the debounce period (saving multiple files
+     * at once starts only one rebuild)
+     *
+     * @param debounce quiet period
+     * @return list of changed paths (unique, sorted)
+     */
+    std::vector<std::filesystem::path> wait(std::chrono::milliseconds debounce);
+
+protected:
+
+    struct Directory {
+        std::unordered_set<std::filesystem::path> names;  ///<watched entries
+        bool whole = false;                 ///<report changes of entries as change of the directory
+    };
+
+    std::unordered_map<std::filesystem::path, Directory> _dirs;
+    std::unordered_set<std::filesystem::path> _changed;
+
+#ifdef __linux__
+    int _fd = -1;
+    std::unordered_map<int, std::filesystem::path> _wd_map;
+    std::unordered_map<std::filesystem::path, int> _dir_wd;
+
+    ///read pending events, returns false on timeout
+    bool read_events(int timeout_ms);
+#else
+    std::unordered_map<std::filesystem::path, std::filesystem::file_time_type> _mtimes;
+
+    static std::filesystem::file_time_type get_mtime(const std::filesystem::path &p);
+    void poll_changes();
+#endif
+};
+
+
+#ifdef __linux__
+
+static constexpr std::uint32_t watch_mask = IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE
+                                          | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+static constexpr std::uint32_t entry_mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+FileWatcher::FileWatcher() {
+    _fd = ::inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+    if (_fd < 0) throw std::system_error(errno, std::system_category(), "inotify_init1");
+}
+
+FileWatcher::~FileWatcher() {
+    ::close(_fd);
+}
+
+void FileWatcher::watch(std::span<const std::filesystem::path> files,
+                        std::span<const std::filesystem::path> directories) {
+    std::unordered_map<std::filesystem::path, Directory> dirs;
+    for (const auto &f: files) {
+        if (!f.is_absolute() || !f.has_filename()) continue;
+        dirs[f.parent_path()].names.insert(f.filename());
+    }
+    for (const auto &d: directories) {
+        if (!d.is_absolute()) continue;
+        dirs[d].whole = true;
+    }
+    for (auto iter = _dir_wd.begin(); iter != _dir_wd.end();) {
+        if (dirs.find(iter->first) == dirs.end()) {
+            ::inotify_rm_watch(_fd, iter->second);
+            _wd_map.erase(iter->second);
+            iter = _dir_wd.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    for (const auto &[d, _]: dirs) {
+        if (_dir_wd.find(d) != _dir_wd.end()) continue;
+        int wd = ::inotify_add_watch(_fd, d.c_str(), watch_mask);
+        if (wd < 0) {
+            //directory doesn't exist (yet), its parent is not watched
+            Log::debug("Can't watch directory {}: errno {}", [&]{return d.string();}, errno);
+            continue;
+        }
+        _wd_map[wd] = d;
+        _dir_wd[d] = wd;
+    }
+    _dirs = std::move(dirs);
+}
+
+bool FileWatcher::read_events(int timeout_ms) {
+    static auto &cnt = Stats::counter("watch.events");
+    pollfd pfd = {_fd, POLLIN, 0};
+    int r = ::poll(&pfd, 1, timeout_ms);
+    if (r < 0) {
+        if (errno == EINTR) return true;
+        throw std::system_error(errno, std::system_category(), "poll");
+    }
+    if (r == 0) return false;
+    alignas(inotify_event) char buffer[16384];
+    while (true) {
+        auto len = ::read(_fd, buffer, sizeof(buffer));
+        if (len <= 0) break;
+        for (char *ptr = buffer; ptr < buffer + len; ) {
+            const auto *ev = reinterpret_cast<const inotify_event *>(ptr);
+            ptr += sizeof(inotify_event) + ev->len;
+            cnt.add();
+            auto witer = _wd_map.find(ev->wd);
+            if (witer == _wd_map.end()) continue;
+            const auto &dir = witer->second;
+            auto diter = _dirs.find(dir);
+            if (ev->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) {
+                //the directory itself is gone
+                if (diter != _dirs.end()) {
+                    if (diter->second.whole) _changed.insert(dir);
+                    for (const auto &n: diter->second.names) _changed.insert(dir/n);
+                }
+                if (ev->mask & IN_IGNORED) {
+                    _dir_wd.erase(dir);
+                    _wd_map.erase(witer);
+                }
+                continue;
+            }
+            if (diter == _dirs.end() || !ev->len) continue;
+            std::filesystem::path name(ev->name);
+            if (diter->second.names.count(name)) _changed.insert(dir/name);
+            if (diter->second.whole && (ev->mask & entry_mask)) _changed.insert(dir);
+        }
+    }
+    return true;
+}
+
+std::vector<std::filesystem::path> FileWatcher::wait(std::chrono::milliseconds debounce) {
+    while (_changed.empty()) read_events(-1);
+    while (read_events(static_cast<int>(debounce.count())));
+    std::vector<std::filesystem::path> out(_changed.begin(), _changed.end());
+    _changed.clear();
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+#else
+
+FileWatcher::FileWatcher() = default;
+FileWatcher::~FileWatcher() = default;
+
+std::filesystem::file_time_type FileWatcher::get_mtime(const std::filesystem::path &p) {
+    std::error_code ec;
+    auto tm = std::filesystem::last_write_time(p, ec);
+    return ec?std::filesystem::file_time_type::min():tm;
+}
+
+void FileWatcher::watch(std::span<const std::filesystem::path> files,
+                        std::span<const std::filesystem::path> directories) {
+    std::unordered_map<std::filesystem::path, std::filesystem::file_time_type> mtimes;
+    for (const auto &f: files) mtimes.emplace(f, get_mtime(f));
+    for (const auto &d: directories) mtimes.emplace(d, get_mtime(d));
+    _mtimes = std::move(mtimes);
+}
+
+void FileWatcher::poll_changes() {
+    for (auto &[p, tm]: _mtimes) {
+        auto n = get_mtime(p);
+        if (n != tm) {
+            tm = n;
+            _changed.insert(p);
+        }
+    }
+}
+
+std::vector<std::filesystem::path> FileWatcher::wait(std::chrono::milliseconds debounce) {
+    static constexpr auto poll_interval = std::chrono::milliseconds(250);
+    while (_changed.empty()) {
+        std::this_thread::sleep_for(poll_interval);
+        poll_changes();
+    }
+    while (true) {
+        auto cnt = _changed.size();
+        std::this_thread::sleep_for(std::max(debounce, poll_interval));
+        poll_changes();
+        if (cnt == _changed.size()) break;
+    }
+    std::vector<std::filesystem::path> out(_changed.begin(), _changed.end());
+    _changed.clear();
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+#endif
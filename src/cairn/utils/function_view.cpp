@@ -27,7 +27,7 @@ public:
 
 protected:
     const void *_closure = nullptr;
-    void (*_fn)(const void *, Args ... ) = nullptr;
+    R (*_fn)(const void *, Args ... ) = nullptr;
 
     template<typename Fn>
     constexpr static R invoke_fn(const void *cctx, Args ... args) {
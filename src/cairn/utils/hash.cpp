@@ -1,6 +1,14 @@
 export module cairn.utils.hash;
 
+import <array>;
+import <bit>;
 import <cstddef>;
+import <cstdint>;
+import <cstring>;
+import <filesystem>;
+import <fstream>;
+import <string>;
+import <string_view>;
 import <utility>;
 export inline std::size_t hash_combine(std::size_t lhs, std::size_t rhs) noexcept
 {
@@ -14,3 +22,184 @@ export struct MethodHash {
         return key.hash();
     }
 };
+
+///Incremental 64-bit hash of a content (not cryptographic)
+/**
+ * It is used to detect change of content of files, the result is
+ * stable across runs. Data are processed by 8 bytes, so the
+ * hash of a large file (BMI) is fast to compute. The result is never zero,
+ * zero is reserved for "unknown"
+ */
+export class ContentHash {
+public:
+
+    void update(std::string_view data) {
+        std::size_t pos = 0;
+        _length += data.size();
+        if (_pending) {
+            while (_pending < 8 && pos < data.size()) _buffer[_pending++] = data[pos++];
+            if (_pending < 8) return;
+            mix(_buffer);
+            _pending = 0;
+        }
+        while (pos + 8 <= data.size()) {
+            mix(data.data()+pos);
+            pos += 8;
+        }
+        while (pos < data.size()) _buffer[_pending++] = data[pos++];
+    }
+
+    std::uint64_t value() const {
+        std::uint64_t h = _state;
+        for (unsigned int i = 0; i < _pending; ++i) {
+            h = (h ^ static_cast<unsigned char>(_buffer[i])) * prime;
+        }
+        h ^= _length;
+        //finalizer of murmur3
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h?h:1;
+    }
+
+protected:
+    static constexpr std::uint64_t prime = 0x100000001b3ULL;
+    std::uint64_t _state = 0xcbf29ce484222325ULL;
+    std::uint64_t _length = 0;
+    char _buffer[8] = {};
+    unsigned int _pending = 0;
+
+    void mix(const char *data) {
+        std::uint64_t w;
+        std::memcpy(&w, data, sizeof(w));
+        _state = std::rotl((_state ^ w) * prime, 31);
+    }
+};
+
+///Compute hash of content of the file
+/**
+ * @param path path to the file
+ * @return hash of the content, or zero if the file cannot be read
+ */
+export std::uint64_t hash_file(const std::filesystem::path &path) {
+    std::ifstream f(path, std::ios::in|std::ios::binary);
+    if (!f) return 0;
+    ContentHash h;
+    char buff[65536];
+    while (f) {
+        f.read(buff, sizeof(buff));
+        h.update(std::string_view(buff, static_cast<std::size_t>(f.gcount())));
+    }
+    if (f.bad()) return 0;
+    return h.value();
+}
+
+///SHA-256 (FIPS 180-4)
+/**
+ * Used to authenticate clients of the compile worker. It is not used to
+ * hash files, ContentHash is much faster
+ */
+export class Sha256 {
+public:
+
+    void update(std::string_view data) {
+        for (char c: data) {
+            _buffer[_pending++] = static_cast<unsigned char>(c);
+            if (_pending == 64) {
+                transform();
+                _pending = 0;
+            }
+        }
+        _length += data.size();
+    }
+
+    ///Finish the computation and return the digest (32 bytes)
+    std::string digest() {
+        std::uint64_t bits = _length * 8;
+        _buffer[_pending++] = 0x80;
+        if (_pending > 56) {
+            while (_pending < 64) _buffer[_pending++] = 0;
+            transform();
+            _pending = 0;
+        }
+        while (_pending < 56) _buffer[_pending++] = 0;
+        for (int i = 7; i >= 0; --i) _buffer[_pending++] = static_cast<unsigned char>(bits >> (i * 8));
+        transform();
+        std::string out;
+        for (auto h: _state) {
+            for (int i = 3; i >= 0; --i) out.push_back(static_cast<char>(h >> (i * 8)));
+        }
+        return out;
+    }
+
+protected:
+    static constexpr std::array<std::uint32_t, 64> k = {
+        0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
+        0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
+        0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
+        0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
+        0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
+        0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
+        0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
+        0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2};
+
+    std::array<std::uint32_t, 8> _state = {
+        0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19};
+    std::array<unsigned char, 64> _buffer = {};
+    unsigned int _pending = 0;
+    std::uint64_t _length = 0;
+
+    void transform() {
+        std::array<std::uint32_t, 64> w;
+        for (unsigned int i = 0; i < 16; ++i) {
+            w[i] = (std::uint32_t{_buffer[i*4]} << 24) | (std::uint32_t{_buffer[i*4+1]} << 16)
+                 | (std::uint32_t{_buffer[i*4+2]} << 8) | std::uint32_t{_buffer[i*4+3]};
+        }
+        for (unsigned int i = 16; i < 64; ++i) {
+            auto s0 = std::rotr(w[i-15], 7) ^ std::rotr(w[i-15], 18) ^ (w[i-15] >> 3);
+            auto s1 = std::rotr(w[i-2], 17) ^ std::rotr(w[i-2], 19) ^ (w[i-2] >> 10);
+            w[i] = w[i-16] + s0 + w[i-7] + s1;
+        }
+        auto [a, b, c, d, e, f, g, h] = _state;
+        for (unsigned int i = 0; i < 64; ++i) {
+            auto s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+            auto ch = (e & f) ^ (~e & g);
+            auto t1 = h + s1 + ch + k[i] + w[i];
+            auto s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+            auto maj = (a & b) ^ (a & c) ^ (b & c);
+            auto t2 = s0 + maj;
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
+        _state[0] += a; _state[1] += b; _state[2] += c; _state[3] += d;
+        _state[4] += e; _state[5] += f; _state[6] += g; _state[7] += h;
+    }
+};
+
+///Compute HMAC-SHA256 of the message (RFC 2104)
+/**
+ * @param key secret key
+ * @param message message
+ * @return authentication code (32 bytes)
+ */
+export std::string hmac_sha256(std::string_view key, std::string_view message) {
+    std::string k(key);
+    if (k.size() > 64) {
+        Sha256 h;
+        h.update(k);
+        k = h.digest();
+    }
+    k.resize(64, '\0');
+    std::string ipad = k, opad = k;
+    for (auto &c: ipad) c ^= 0x36;
+    for (auto &c: opad) c ^= 0x5c;
+    Sha256 inner;
+    inner.update(ipad);
+    inner.update(message);
+    Sha256 outer;
+    outer.update(opad);
+    outer.update(inner.digest());
+    return outer.digest();
+}
@@ -0,0 +1,280 @@
+module;
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#endif
+
+export module cairn.utils.jobserver;
+
+import cairn.utils.log;
+
+import <cerrno>;
+import <cstdlib>;
+import <filesystem>;
+import <format>;
+import <memory>;
+import <optional>;
+import <stdexcept>;
+import <string>;
+import <string_view>;
+import <system_error>;
+
+
+///GNU make compatible jobserver
+/**
+ * The jobserver holds tokens. Each job (except the first one, which owns
+ * implicit token) must acquire a token before it is started and release the token
+ * after it is finished.
+ *
+ * Client mode: connects to jobserver of parent make (MAKEFLAGS --jobserver-auth)
+ * Server mode: creates a jobserver and exports it through MAKEFLAGS to child
+ * processes, so compilers which supports jobserver (LTO) share the same budget
+ */
+export class JobServer {
+public:
+
+    using Token = char;
+
+    JobServer(const JobServer &) = delete;
+    JobServer &operator=(const JobServer &) = delete;
+    ~JobServer();
+
+    ///Connect to jobserver of the parent process
+    /**
+     * @return pointer to jobserver, or nullptr, if there is no jobserver available
+     */
+    static std::unique_ptr<JobServer> connect();
+
+    ///Create new jobserver
+    /**
+     * @param jobs total count of jobs (including implicit job)
+     * @return jobserver. The jobserver is exported to environment variable MAKEFLAGS,
+     * previous value is restored, when the jobserver is destroyed
+     */
+    static std::unique_ptr<JobServer> create(unsigned int jobs);
+
+    ///Acquire token, don't block
+    /**
+     * @return token, or nullopt, if no token is available now. Errors of the
+     * jobserver are also reported as no token
+     */
+    std::optional<Token> try_acquire();
+
+    ///Release the token
+    void release(Token t);
+
+    ///returns true, if this is server
+    bool is_server() const {return _server;}
+
+protected:
+
+    JobServer() = default;
+
+    bool _server = false;
+    std::optional<std::string> _prev_makeflags;     //value of MAKEFLAGS before it was exported
+#ifdef _WIN32
+    HANDLE _semaphore = NULL;
+#else
+    int _read_fd = -1;
+    int _write_fd = -1;
+    std::filesystem::path _fifo;
+#endif
+
+    static std::string_view find_auth(std::string_view makeflags);
+    void export_makeflags(std::string_view auth, unsigned int jobs);
+    void restore_makeflags();
+};
+
+std::string_view JobServer::find_auth(std::string_view makeflags) {
+    //the last occurrence wins
+    for (std::string_view sw: {"--jobserver-auth=", "--jobserver-fds="}) {
+        auto pos = makeflags.rfind(sw);
+        if (pos != makeflags.npos) {
+            auto val = makeflags.substr(pos + sw.size());
+            return val.substr(0, val.find(' '));
+        }
+    }
+    return {};
+}
+
+#ifdef _WIN32
+
+JobServer::~JobServer() {
+    if (_server) restore_makeflags();
+    if (_semaphore) CloseHandle(_semaphore);
+}
+
+void JobServer::export_makeflags(std::string_view auth, unsigned int jobs) {
+    const char *mf = std::getenv("MAKEFLAGS");
+    if (mf) _prev_makeflags = mf;
+    std::string makeflags = mf && *mf?std::format("{} ", mf):std::string();
+    makeflags.append(std::format("-j{} --jobserver-auth={}", jobs, auth));
+    SetEnvironmentVariableA("MAKEFLAGS", makeflags.c_str());
+}
+
+void JobServer::restore_makeflags() {
+    SetEnvironmentVariableA("MAKEFLAGS", _prev_makeflags?_prev_makeflags->c_str():NULL);
+}
+
+std::unique_ptr<JobServer> JobServer::connect() {
+    const char *mf = std::getenv("MAKEFLAGS");
+    if (!mf) return nullptr;
+    auto auth = find_auth(mf);
+    if (auth.empty()) return nullptr;
+    std::string name(auth);
+    HANDLE h = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, name.c_str());
+    if (!h) {
+        Log::warning("Jobserver {} is not available - ignored", name);
+        return nullptr;
+    }
+    std::unique_ptr<JobServer> out(new JobServer);
+    out->_semaphore = h;
+    return out;
+}
+
+std::unique_ptr<JobServer> JobServer::create(unsigned int jobs) {
+    std::string name = std::format("cairn_jobserver_{}", GetCurrentProcessId());
+    LONG tokens = static_cast<LONG>(jobs > 1?jobs - 1:0);
+    HANDLE h = CreateSemaphoreA(NULL, tokens, tokens > 0?tokens:1, name.c_str());
+    if (!h) throw std::system_error(GetLastError(), std::system_category(), "Unable to create jobserver");
+    std::unique_ptr<JobServer> out(new JobServer);
+    out->_semaphore = h;
+    out->_server = true;
+    out->export_makeflags(name, jobs);
+    return out;
+}
+
+std::optional<JobServer::Token> JobServer::try_acquire() {
+    if (WaitForSingleObject(_semaphore, 0) != WAIT_OBJECT_0) return std::nullopt;
+    return '+';
+}
+
+void JobServer::release(Token) {
+    if (!ReleaseSemaphore(_semaphore, 1, NULL)) {
+        Log::error("Jobserver: failed to return a token, the job slot is lost: {}",
+                std::system_category().message(static_cast<int>(GetLastError())));
+    }
+}
+
+#else
+
+JobServer::~JobServer() {
+    if (_write_fd != _read_fd && _write_fd >= 0) ::close(_write_fd);
+    if (_read_fd >= 0) ::close(_read_fd);
+    if (_server) {
+        restore_makeflags();
+        std::error_code ec;
+        std::filesystem::remove(_fifo, ec);
+    }
+}
+
+void JobServer::export_makeflags(std::string_view auth, unsigned int jobs) {
+    const char *mf = std::getenv("MAKEFLAGS");
+    if (mf) _prev_makeflags = mf;
+    std::string makeflags = mf && *mf?std::format("{} ", mf):std::string();
+    makeflags.append(std::format("-j{} --jobserver-auth={}", jobs, auth));
+    ::setenv("MAKEFLAGS", makeflags.c_str(), 1);
+}
+
+void JobServer::restore_makeflags() {
+    if (_prev_makeflags) ::setenv("MAKEFLAGS", _prev_makeflags->c_str(), 1);
+    else ::unsetenv("MAKEFLAGS");
+}
+
+static bool is_valid_fd(int fd) {
+    return fd >= 0 && ::fcntl(fd, F_GETFD) != -1;
+}
+
+std::unique_ptr<JobServer> JobServer::connect() {
+    const char *mf = std::getenv("MAKEFLAGS");
+    if (!mf) return nullptr;
+    auto auth = find_auth(mf);
+    if (auth.empty()) return nullptr;
+    std::unique_ptr<JobServer> out(new JobServer);
+    if (auth.starts_with("fifo:")) {
+        out->_fifo = std::string(auth.substr(5));
+        int fd = ::open(out->_fifo.c_str(), O_RDWR|O_CLOEXEC|O_NONBLOCK);
+        if (fd < 0) {
+            Log::warning("Jobserver {} is not available - ignored", out->_fifo.string());
+            return nullptr;
+        }
+        out->_read_fd = out->_write_fd = fd;
+    } else {
+        auto sep = auth.find(',');
+        std::string rd(auth.substr(0, sep));
+        std::string wr(sep == auth.npos?std::string_view():auth.substr(sep+1));
+        int r = std::atoi(rd.c_str());
+        int w = std::atoi(wr.c_str());
+        if (sep == auth.npos || !is_valid_fd(r) || !is_valid_fd(w)) {
+            Log::warning("Jobserver descriptors {} are not available (is the rule marked with '+'?) - ignored", auth);
+            return nullptr;
+        }
+        //descriptors are inherited, so make them private. The pipe is shared with make,
+        //so O_NONBLOCK can't be set on it. Reopening creates own description of the pipe
+        //(Linux). A blocking read end can't be used, another client can take the token
+        //first and the read would block the scheduler
+        auto proc_fd = std::format("/proc/self/fd/{}", r);
+        out->_read_fd = ::open(proc_fd.c_str(), O_RDONLY|O_CLOEXEC|O_NONBLOCK);
+        if (out->_read_fd < 0) {
+            Log::warning("Jobserver descriptors {} can't be reopened as non-blocking (use make --jobserver-style=fifo) - ignored", auth);
+            return nullptr;
+        }
+        out->_write_fd = ::fcntl(w, F_DUPFD_CLOEXEC, 0);
+    }
+    return out;
+}
+
+std::unique_ptr<JobServer> JobServer::create(unsigned int jobs) {
+    auto fifo = std::filesystem::temp_directory_path() / std::format("cairn_jobserver_{}", ::getpid());
+    std::filesystem::remove(fifo);
+    if (::mkfifo(fifo.c_str(), 0600) == -1) {
+        throw std::system_error(errno, std::system_category(), "Unable to create jobserver: " + fifo.string());
+    }
+    std::unique_ptr<JobServer> out(new JobServer);
+    out->_server = true;
+    out->_fifo = fifo;
+    int fd = ::open(fifo.c_str(), O_RDWR|O_CLOEXEC|O_NONBLOCK);
+    if (fd < 0) {
+        throw std::system_error(errno, std::system_category(), "Unable to open jobserver: " + fifo.string());
+    }
+    out->_read_fd = out->_write_fd = fd;
+    for (unsigned int i = 1; i < jobs; ++i) out->release('+');
+    out->export_makeflags(std::format("fifo:{}", fifo.string()), jobs);
+    return out;
+}
+
+std::optional<JobServer::Token> JobServer::try_acquire() {
+    Token t;
+    while (true) {
+        auto r = ::read(_read_fd, &t, 1);
+        if (r == 1) return t;
+        int err = errno;
+        if (r == -1 && err == EINTR) continue;
+        if (r == 0) Log::debug("Jobserver closed");
+        else if (err != EAGAIN && err != EWOULDBLOCK) Log::debug("Jobserver: {}", [&]{return std::system_category().message(err);});
+        return std::nullopt;
+    }
+}
+
+void JobServer::release(Token t) {
+    while (::write(_write_fd, &t, 1) != 1) {
+        int err = errno;
+        if (err == EINTR) continue;
+        if (err == EAGAIN || err == EWOULDBLOCK) {
+            //the pipe is full, wait until other clients take tokens
+            pollfd pfd = {_write_fd, POLLOUT, 0};
+            ::poll(&pfd, 1, -1);
+            continue;
+        }
+        Log::error("Jobserver: failed to return a token, the job slot is lost: {}", std::system_category().message(err));
+        return;
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+module;
+
+#ifndef _WIN32
+#include <stdlib.h>
+#endif
+
+export module cairn.utils.load_monitor;
+
+import cairn.utils.log;
+
+import <algorithm>;
+import <chrono>;
+import <fstream>;
+import <optional>;
+import <string>;
+import <thread>;
+
+
+///Adapts count of parallel jobs to system load
+/**
+ * Samples pressure stall information (/proc/pressure/memory, /proc/pressure/cpu)
+ * and load average. When the system is under pressure, count of jobs is lowered,
+ * when the system is idle, count of jobs is raised up to the limit.
+ *
+ * On systems without PSI only load average is used. On systems without
+ * load average (Windows) the count of jobs is not changed
+ */
+export class LoadMonitor {
+public:
+
+    struct Sample {
+        std::optional<double> mem_some;     ///<memory pressure - some avg10 (percent)
+        std::optional<double> mem_full;     ///<memory pressure - full avg10 (percent)
+        std::optional<double> cpu_some;     ///<cpu pressure - some avg10 (percent)
+        std::optional<double> loadavg;      ///<load average (1 minute)
+    };
+
+    ///Memory pressure (some) above this level lowers count of jobs
+    static constexpr double mem_some_high = 10.0;
+    ///Memory pressure (full) above this level lowers count of jobs
+    static constexpr double mem_full_high = 1.0;
+    ///Memory pressure (some) below this level allows to raise count of jobs
+    static constexpr double mem_some_low = 2.0;
+    ///CPU pressure (some) above this level prevents to raise count of jobs
+    static constexpr double cpu_some_high = 50.0;
+    ///Load per cpu above this level lowers count of jobs
+    static constexpr double load_high = 1.5;
+    ///Interval between samples
+    static constexpr auto sample_interval = std::chrono::seconds(2);
+
+    LoadMonitor():_cpus(std::max(1U, std::thread::hardware_concurrency())) {}
+
+    ///Read current state of the system
+    static Sample sample();
+
+    ///Calculate new count of jobs
+    /**
+     * @param current current count of jobs
+     * @param limit max count of jobs
+     * @return new count of jobs. Returns current value, if the sample
+     * interval is not elapsed yet
+     */
+    std::size_t adjust(std::size_t current, std::size_t limit);
+
+protected:
+    unsigned int _cpus;
+    std::chrono::steady_clock::time_point _next_sample = {};
+
+    static std::optional<double> read_pressure(const char *fname, std::string_view type);
+};
+
+std::optional<double> LoadMonitor::read_pressure(const char *fname, std::string_view type) {
+    //format: some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    std::ifstream f(fname);
+    std::string kind;
+    std::string avg10;
+    while (f >> kind >> avg10) {
+        if (kind == type && avg10.starts_with("avg10=")) {
+            try {
+                return std::stod(avg10.substr(6));
+            } catch (...) {
+                return std::nullopt;
+            }
+        }
+        std::getline(f, kind);
+    }
+    return std::nullopt;
+}
+
+LoadMonitor::Sample LoadMonitor::sample() {
+    Sample s;
+#ifndef _WIN32
+    s.mem_some = read_pressure("/proc/pressure/memory", "some");
+    s.mem_full = read_pressure("/proc/pressure/memory", "full");
+    s.cpu_some = read_pressure("/proc/pressure/cpu", "some");
+    double l;
+    if (::getloadavg(&l, 1) == 1) s.loadavg = l;
+#endif
+    return s;
+}
+
+std::size_t LoadMonitor::adjust(std::size_t current, std::size_t limit) {
+    auto now = std::chrono::steady_clock::now();
+    if (now < _next_sample) return current;
+    _next_sample = now + sample_interval;
+
+    auto s = sample();
+    double load_per_cpu = s.loadavg.value_or(0.0) / _cpus;
+    bool mem_high = s.mem_some.value_or(0.0) > mem_some_high || s.mem_full.value_or(0.0) > mem_full_high;
+    bool cpu_high = s.cpu_some.value_or(0.0) > cpu_some_high;
+    bool load_is_high = load_per_cpu > load_high;
+    bool idle = s.loadavg.has_value() && s.mem_some.value_or(0.0) < mem_some_low && !cpu_high && load_per_cpu < 1.0;
+
+    std::size_t r = current;
+    if (mem_high) {
+        //memory pressure is dangerous (OOM), so lower quickly
+        r = current - current/4 - 1;
+    } else if (load_is_high) {
+        r = current - 1;
+    } else if (idle) {
+        r = current + 1;
+    }
+    r = std::clamp<std::size_t>(r, 1, std::max<std::size_t>(limit, 1));
+    if (r != current) {
+        Log::verbose("Adjusting jobs {} -> {} (memory pressure: {:.1f}%/{:.1f}%, cpu pressure: {:.1f}%, load: {:.2f})",
+            current, r, s.mem_some.value_or(0.0), s.mem_full.value_or(0.0), s.cpu_some.value_or(0.0), s.loadavg.value_or(0.0));
+    }
+    return r;
+}
@@ -4,14 +4,27 @@ module;
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/wait.h>
+#include <sys/resource.h>
 #include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
 #include "env_extern.hpp"
 
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+#define CAIRN_HAVE_SPAWN_CHDIR 1
+#elif defined(__APPLE__)
+#define CAIRN_HAVE_SPAWN_CHDIR 1
+#else
+#define CAIRN_HAVE_SPAWN_CHDIR 0
+#endif
+
 export module cairn.utils.process:posix;
 import cairn.utils.arguments;
 import cairn.utils.fd_streambuf;
 import cairn.utils.env;
 import cairn.utils.log;
+import cairn.utils.stats;
 
 import <cstddef>;
 import <filesystem>;
@@ -29,11 +42,20 @@ import <optional>;
 import <span>;
 import <iostream>;
 import <vector>;
+import <functional>;
+import <thread>;
+import <mutex>;
+import <atomic>;
+import <chrono>;
+import <unordered_map>;
+import <unordered_set>;
 
 
 export class Process {
 public:
     const int pid = -1;
+    ///peak memory of the process in bytes, set by waitpid_status() (0 - unknown)
+    std::size_t peak_memory = 0;
     std::optional<fd_streambuf> child_stdin_buf;
     std::optional<fd_streambuf> child_stdout_buf;
     std::optional<fd_streambuf> child_stderr_buf;
@@ -99,12 +121,18 @@ int Process::waitpid_status() {
     if (pid <= 0) return -1;
     int status;
     pid_t r;
+    rusage ru = {};
     do {
-        r = ::waitpid(pid, &status, 0);
+        r = ::wait4(pid, &status, 0, &ru);
     } while (r == -1 && errno == EINTR);
     if (r == -1) {
         throw std::runtime_error(std::string("waitpid failed: ") + std::strerror(errno));
     }
+#ifdef __APPLE__
+    peak_memory = static_cast<std::size_t>(ru.ru_maxrss);           //bytes
+#else
+    peak_memory = static_cast<std::size_t>(ru.ru_maxrss) * 1024;    //kilobytes
+#endif
     return status;
 }
 
@@ -157,6 +185,7 @@ public:
     operator int() const {return _fd;}
     void close() {
         if (_fd != -1) ::close(_fd);
+        _fd = -1;
     }
     ~FD() {close();}
     int release() {
@@ -210,6 +239,21 @@ Process Process::spawn(const std::filesystem::path &path,
     }
 
 
+#if CAIRN_HAVE_SPAWN_CHDIR
+    //working directory is changed in the child, parent's cwd is not touched
+    std::string workdir_str = workdir.string();
+    if (!workdir_str.empty()) {
+        int r = posix_spawn_file_actions_addchdir_np(&actions, workdir_str.c_str());
+        if (r != 0) {
+            posix_spawn_file_actions_destroy(&actions);
+            throw std::system_error(r, std::system_category(), "Unable to set working directory: " + workdir_str);
+        }
+    }
+#else
+    //fallback: change cwd in parent. This is process global state, so
+    //concurrent spawns must be serialized
+    static std::mutex cwd_mx;
+    std::lock_guard cwd_lock(cwd_mx);
     auto cd = std::filesystem::current_path();
     auto cd_ret = std::unique_ptr<std::filesystem::path, decltype([](auto *x){
         std::filesystem::current_path(*x);
@@ -220,17 +264,21 @@ Process Process::spawn(const std::filesystem::path &path,
     if (ec != std::error_code{}) {
         throw std::system_error(ec, workdir);
     }
+#endif
 
-    std::string pathstr = path.string();
+    const std::string &pathstr = path.native();
 
     std::size_t reqspace = pathstr.length()+1+std::accumulate(args.begin(), args.end(), std::size_t(0), 
         [](std::size_t a, const ArgumentString &s) {
             return a + s.length()+1;
         });        
                          
-
-    std::vector<char> arg_buffer(reqspace);
-    std::vector<char *> pointers(args.size()+2);  //args + arg0 + NULL;
+    //buffers are reused by next spawn in the same thread
+    thread_local std::vector<char> arg_buffer;
+    thread_local std::vector<char *> pointers;  //args + arg0 + NULL;
+    thread_local SystemEnvironment::Buffer env_buffer;
+    arg_buffer.resize(reqspace);
+    pointers.resize(args.size()+2);
 
     {
         char *wrt = arg_buffer.data();
@@ -247,7 +295,6 @@ Process Process::spawn(const std::filesystem::path &path,
     }
 
     char **pointers_env = environ;
-    SystemEnvironment::Buffer env_buffer;
     if (env.has_value()) {
         pointers_env = reinterpret_cast<char **>(env->posix_format(env_buffer));
     }
@@ -264,8 +311,17 @@ Process Process::spawn(const std::filesystem::path &path,
     posix_spawn_file_actions_destroy(&actions);
 
     if (rc != 0) {
+#if CAIRN_HAVE_SPAWN_CHDIR
+        //failed chdir in the child is reported as failure of posix_spawn
+        std::error_code ec;
+        if (!workdir.empty() && !std::filesystem::is_directory(workdir, ec)) {
+            throw std::system_error(rc, std::system_category(), "Working directory is not accessible: " + workdir.string());
+        }
+#endif
         throw std::runtime_error(std::string("posix_spawn failed: ") + std::strerror(rc));
     }
+    static auto &spawned = Stats::counter("process.spawned");
+    spawned.add();
 
     return Process (child_pid,
         pstdin?pstdin->write.release():-1,
@@ -273,3 +329,375 @@ Process Process::spawn(const std::filesystem::path &path,
         pstderr?pstderr->read.release():-1    
     );
 }
+
+
+///Waits for multiple child processes using single thread
+/**
+ * The monitor runs one thread with an epoll loop. It waits for exit of
+ * the child processes (through pidfd, or SIGCHLD and a self-pipe where pidfd
+ * is not available) and collects their captured output.
+ * When the process exits and all its output is read, the callback is called.
+ * Callbacks are called from the monitor's thread, so they should not block
+ * for long time. The callback can start and watch a next process.
+ */
+export class ProcessMonitor {
+public:
+
+    ///Called when process exits
+    /**
+     * @param status exit status (as returned by waitpid)
+     * @param output captured output of the process (stdout and stderr, if captured)
+     * @param peak_memory peak resident set size of the process in bytes (0 - unknown)
+     */
+    using Callback = std::function<void(int status, std::string output, std::size_t peak_memory)>;
+
+    ProcessMonitor();
+    ~ProcessMonitor();
+    ProcessMonitor(const ProcessMonitor &) = delete;
+    ProcessMonitor &operator=(const ProcessMonitor &) = delete;
+
+    ///Start watching the process
+    /**
+     * @param p process. The monitor takes ownership of the process and its 
+     * output streams. Input stream is closed
+     * @param cb callback called when process exits
+     * @param timeout optional timeout. When timeout expires, the process is killed
+     * @exception std::runtime_error the monitor has failed, the process is killed
+     */
+    void watch(Process &&p, Callback cb, std::chrono::milliseconds timeout = {});
+
+    ///Terminate all watched processes
+    /** Callbacks are still called once the processes exit */
+    void cancel_all();
+
+    ///Retrieve shared instance
+    static ProcessMonitor &instance();
+
+protected:
+
+    struct Entry {
+        int pid = -1;
+        FD exitfd;                  ///<pidfd (not used with SIGCHLD)
+        FD out;
+        FD err;
+        bool use_sigchld = false;   ///<pidfd is not available, exit is detected by SIGCHLD
+        bool exited = false;
+        bool killed = false;
+        std::atomic<int> status = 0;
+        std::atomic<std::size_t> peak_memory = 0;
+        std::chrono::steady_clock::time_point deadline = {};
+        std::string output;
+        Callback cb;
+    };
+
+    using PEntry = std::shared_ptr<Entry>;
+
+    std::mutex _mx;
+    FD _epoll;
+    FD _wakeup;
+    std::unordered_map<int, PEntry> _fds;
+    std::unordered_set<PEntry> _entries;
+    FD _sigchld;                    ///<read end of the SIGCHLD self-pipe (if installed)
+    bool _exit = false;
+    bool _failed = false;
+    std::thread _thr;
+
+    void worker();
+    void register_fd(int fd, const PEntry &e);
+    void unregister_fd(FD &fd);
+    void wakeup();
+    void install_sigchld();
+    void reap_exited(std::vector<PEntry> &finished);
+    void fail_all(std::vector<PEntry> &finished);
+    static bool read_output(int fd, std::string &out);
+    static bool reap(Entry &e, int options);
+};
+
+static int open_pidfd(int pid) {
+#ifdef SYS_pidfd_open
+    return static_cast<int>(::syscall(SYS_pidfd_open, pid, 0));
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+///write end of the self-pipe, written by the SIGCHLD handler
+static int sigchld_pipe = -1;
+
+static void on_sigchld(int) {
+    int e = errno;
+    char c = 0;
+    [[maybe_unused]] auto r = ::write(sigchld_pipe, &c, 1);
+    errno = e;
+}
+
+ProcessMonitor::ProcessMonitor()
+    :_epoll(::epoll_create1(EPOLL_CLOEXEC))
+    ,_wakeup(::eventfd(0, EFD_CLOEXEC|EFD_NONBLOCK)) {
+    if (_epoll < 0 || _wakeup < 0) {
+        throw std::system_error(errno, std::system_category(), "Unable to initialize process monitor");
+    }
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = _wakeup;
+    ::epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeup, &ev);
+    _thr = std::thread([this]{worker();});
+}
+
+ProcessMonitor::~ProcessMonitor() {
+    {
+        std::lock_guard _(_mx);
+        _exit = true;
+    }
+    wakeup();
+    _thr.join();
+    //the handler must not write to the pipe, once its read end is closed
+    if (_sigchld >= 0) ::signal(SIGCHLD, SIG_DFL);
+}
+
+ProcessMonitor &ProcessMonitor::instance() {
+    static ProcessMonitor inst;
+    return inst;
+}
+
+void ProcessMonitor::wakeup() {
+    std::uint64_t one = 1;
+    [[maybe_unused]] auto r = ::write(_wakeup, &one, sizeof(one));
+}
+
+void ProcessMonitor::register_fd(int fd, const PEntry &e) {
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (::epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        throw std::system_error(errno, std::system_category(), "epoll_ctl failed");
+    }
+    _fds.emplace(fd, e);
+}
+
+void ProcessMonitor::unregister_fd(FD &fd) {
+    ::epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+    _fds.erase(fd);
+    fd.close();
+}
+
+void ProcessMonitor::install_sigchld() {
+    if (_sigchld >= 0) return;
+    int fds[2];
+    if (::pipe2(fds, O_CLOEXEC|O_NONBLOCK) == -1) {
+        throw std::system_error(errno, std::system_category(), "Unable to create pipe");
+    }
+    _sigchld = FD(fds[0]);
+    sigchld_pipe = fds[1];
+    struct sigaction sa = {};
+    sa.sa_handler = &on_sigchld;
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigemptyset(&sa.sa_mask);
+    ::sigaction(SIGCHLD, &sa, nullptr);
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = _sigchld;
+    if (::epoll_ctl(_epoll, EPOLL_CTL_ADD, _sigchld, &ev) == -1) {
+        throw std::system_error(errno, std::system_category(), "epoll_ctl failed");
+    }
+}
+
+///collects exit status and resource usage of the process
+/**
+ * @param e entry
+ * @param options options of wait4 (WNOHANG)
+ * @retval true process has been reaped (or it can't be waited for)
+ * @retval false process is still running
+ */
+bool ProcessMonitor::reap(Entry &e, int options) {
+    int status = -1;
+    rusage ru = {};
+    int r;
+    do {
+        r = ::wait4(e.pid, &status, options, &ru);
+    } while (r == -1 && errno == EINTR);
+    if (r == 0) return false;
+    if (r == -1) status = -1;
+#ifdef __APPLE__
+    e.peak_memory = static_cast<std::size_t>(ru.ru_maxrss);           //bytes
+#else
+    e.peak_memory = static_cast<std::size_t>(ru.ru_maxrss) * 1024;    //kilobytes
+#endif
+    e.status = status;
+    return true;
+}
+
+///reaps processes without pidfd after SIGCHLD (called under lock)
+/**
+ * Only watched processes are waited for (not waitpid(-1)), other code waits
+ * for its own children synchronously. The process is marked exited under
+ * the lock, so cancel_all() never kills a reused pid
+ */
+void ProcessMonitor::reap_exited(std::vector<PEntry> &finished) {
+    char buff[256];
+    while (::read(_sigchld, buff, sizeof(buff)) > 0);
+    for (const auto &e: _entries) {
+        if (!e->use_sigchld || e->exited || !reap(*e, WNOHANG)) continue;
+        e->exited = true;
+        if (e->out < 0 && e->err < 0) finished.push_back(e);
+    }
+}
+
+///monitor can't continue, all processes are killed and their callbacks are called with failure
+void ProcessMonitor::fail_all(std::vector<PEntry> &finished) {
+    _failed = true;
+    for (const auto &e: _entries) {
+        if (!e->exited) {
+            ::kill(e->pid, SIGKILL);
+            reap(*e, 0);
+            e->exited = true;
+        }
+        e->status = -1;
+        for (FD *fd: {&e->exitfd, &e->out, &e->err}) {
+            if (*fd >= 0) unregister_fd(*fd);
+        }
+        finished.push_back(e);
+    }
+    _entries.clear();
+}
+
+///reads available output, returns true on eof (or error)
+bool ProcessMonitor::read_output(int fd, std::string &out) {
+    char buff[4096];
+    while (true) {
+        auto r = ::read(fd, buff, sizeof(buff));
+        if (r > 0) {
+            out.append(buff, static_cast<std::size_t>(r));
+        } else if (r == -1 && errno == EINTR) {
+            continue;
+        } else {
+            return !(r == -1 && (errno == EAGAIN || errno == EWOULDBLOCK));
+        }
+    }
+}
+
+void ProcessMonitor::watch(Process &&p, Callback cb, std::chrono::milliseconds timeout) {
+    auto e = std::make_shared<Entry>();
+    e->pid = p.pid;
+    e->cb = std::move(cb);
+    if (timeout.count() > 0) {
+        e->deadline = std::chrono::steady_clock::now() + timeout;
+    }
+    p.stdin_stream.reset();
+    p.child_stdin_buf.reset();
+    auto take_stream = [](auto &buf, auto &stream) -> FD {
+        if (!buf.has_value()) return FD();
+        FD fd(buf->release());
+        stream.reset();
+        buf.reset();
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        return fd;
+    };
+    e->out = take_stream(p.child_stdout_buf, p.stdout_stream);
+    e->err = take_stream(p.child_stderr_buf, p.stderr_stream);
+
+    int pfd = open_pidfd(p.pid);
+    if (pfd >= 0) {
+        e->exitfd = FD(pfd);
+    } else {
+        e->use_sigchld = true;
+    }
+
+    std::lock_guard _(_mx);
+    if (_failed) {
+        ::kill(e->pid, SIGKILL);
+        reap(*e, 0);
+        throw std::runtime_error("Process monitor is not running");
+    }
+    if (e->use_sigchld) {
+        install_sigchld();
+    } else {
+        register_fd(e->exitfd, e);
+    }
+    if (e->out >= 0) register_fd(e->out, e);
+    if (e->err >= 0) register_fd(e->err, e);
+    _entries.insert(e);
+    //the process could exit before it was watched - its SIGCHLD is already consumed
+    if (e->use_sigchld) on_sigchld(SIGCHLD);
+    if (timeout.count() > 0) wakeup();
+}
+
+void ProcessMonitor::cancel_all() {
+    std::lock_guard _(_mx);
+    for (const auto &e: _entries) {
+        if (!e->exited && !e->killed) {
+            ::kill(e->pid, SIGTERM);
+            e->killed = true;
+        }
+    }
+}
+
+void ProcessMonitor::worker() {
+    constexpr int max_events = 64;
+    epoll_event events[max_events];
+    std::vector<PEntry> finished;
+    std::unique_lock lk(_mx);
+    while (!_exit && !_failed) {
+        int timeout_ms = -1;
+        auto now = std::chrono::steady_clock::now();
+        for (const auto &e: _entries) {
+            if (e->deadline == std::chrono::steady_clock::time_point{} || e->killed) continue;
+            if (e->deadline <= now) {
+                Log::warning("Process {} timed out - killed", e->pid);
+                ::kill(e->pid, SIGKILL);
+                e->killed = true;
+                continue;
+            }
+            auto ms = static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(e->deadline - now).count());
+            if (timeout_ms < 0 || ms < timeout_ms) timeout_ms = ms;
+        }
+
+        lk.unlock();
+        int n = ::epoll_wait(_epoll, events, max_events, timeout_ms);
+        lk.lock();
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            Log::error("Process monitor: epoll_wait failed: {}", std::strerror(errno));
+            fail_all(finished);
+            n = 0;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == _wakeup) {
+                std::uint64_t cnt;
+                [[maybe_unused]] auto r = ::read(_wakeup, &cnt, sizeof(cnt));
+                continue;
+            }
+            if (fd == _sigchld) {
+                reap_exited(finished);
+                continue;
+            }
+            auto iter = _fds.find(fd);
+            if (iter == _fds.end()) continue;
+            PEntry e = iter->second;
+            if (fd == e->exitfd) {
+                reap(*e, 0);
+                e->exited = true;
+                unregister_fd(e->exitfd);
+            } else {
+                FD &pipe = fd == e->out? e->out : e->err;
+                if (read_output(pipe, e->output)) unregister_fd(pipe);
+            }
+            if (e->exited && e->out < 0 && e->err < 0) {
+                finished.push_back(std::move(e));
+            }
+        }
+        for (const auto &e: finished) _entries.erase(e);
+
+        if (!finished.empty()) {
+            lk.unlock();
+            for (auto &e: finished) {
+                e->cb(e->status, std::move(e->output), e->peak_memory);
+            }
+            finished.clear();
+            lk.lock();
+        }
+    }
+}
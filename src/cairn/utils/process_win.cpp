@@ -2,10 +2,12 @@ module;
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <psapi.h>
 
 export module cairn.utils.process:win;
 
 import cairn.utils.log;
+import cairn.utils.stats;
 import cairn.utils.fd_streambuf;
 import cairn.utils.arguments;
 import cairn.utils.env;
@@ -13,11 +15,19 @@ import cairn.utils.env;
 import <optional>;
 import <filesystem>;
 import <span>;
+import <functional>;
+import <mutex>;
+import <chrono>;
+import <string>;
+import <thread>;
+import <unordered_set>;
 
 
 export class Process {
 public:
     const HANDLE pid = NULL;
+    ///peak memory of the process in bytes, set by waitpid_status() (0 - unknown)
+    std::size_t peak_memory = 0;
     std::optional<fd_streambuf> child_stdin_buf;
     std::optional<fd_streambuf> child_stdout_buf;
     std::optional<fd_streambuf> child_stderr_buf;
@@ -89,6 +99,8 @@ int Process::waitpid_status() {
     if (!GetExitCodeProcess(pid, &status)) {
         throw std::runtime_error("GetExitCodeProcess failed");
     }
+    PROCESS_MEMORY_COUNTERS pmc = {};
+    if (GetProcessMemoryInfo(pid, &pmc, sizeof(pmc))) peak_memory = pmc.PeakWorkingSetSize;
     return static_cast<int>(status);    
 }
 
@@ -116,6 +128,7 @@ public:
     operator HANDLE() const {return _fd;}
     void close() {
         if (_fd != INVALID_HANDLE_VALUE) ::CloseHandle(_fd);
+        _fd = INVALID_HANDLE_VALUE;
     }
     ~FD() {close();}
     HANDLE release() {
@@ -251,6 +264,8 @@ Process Process::spawn(const std::filesystem::path & path,
     if (!res) {
         throw std::system_error(GetLastError(), std::system_category(), "Unable to spawn process");
     }
+    static auto &spawned = Stats::counter("process.spawned");
+    spawned.add();
     // Close unneeded handles
     CloseHandle(pi.hThread);
 
@@ -265,4 +280,170 @@ Process::~Process() {
     if (pid != NULL) {
         CloseHandle(pid);
     }
-}
\ No newline at end of file
+}
+
+///Waits for multiple child processes without dedicated thread per process
+/**
+ * On Windows, waiting is delegated to the system thread pool 
+ * (RegisterWaitForSingleObject). When output is captured, it is read
+ * by a work item before the wait is registered.
+ * Callbacks are called from the system thread pool, so they should not block
+ * for long time. The callback can start and watch a next process.
+ */
+export class ProcessMonitor {
+public:
+
+    ///Called when process exits
+    /**
+     * @param status exit code
+     * @param output captured output of the process (stdout and stderr, if captured)
+     * @param peak_memory peak working set of the process in bytes (0 - unknown)
+     */
+    using Callback = std::function<void(int status, std::string output, std::size_t peak_memory)>;
+
+    ProcessMonitor() = default;
+    ProcessMonitor(const ProcessMonitor &) = delete;
+    ProcessMonitor &operator=(const ProcessMonitor &) = delete;
+
+    ///Start watching the process
+    /**
+     * @param p process. The monitor takes ownership of the process and its 
+     * output streams. Input stream is closed
+     * @param cb callback called when process exits
+     * @param timeout optional timeout. When timeout expires, the process is killed
+     */
+    void watch(Process &&p, Callback cb, std::chrono::milliseconds timeout = {});
+
+    ///Terminate all watched processes
+    /** Callbacks are still called once the processes exit */
+    void cancel_all();
+
+    ///Retrieve shared instance
+    static ProcessMonitor &instance();
+
+protected:
+
+    struct Entry {
+        ProcessMonitor *owner = nullptr;
+        FD process;
+        FD out;
+        FD err;
+        HANDLE wait_handle = NULL;
+        DWORD timeout = INFINITE;
+        std::string output;
+        Callback cb;
+    };
+
+    std::mutex _mx;
+    std::unordered_set<Entry *> _entries;
+
+    void register_wait(Entry *e);
+    static DWORD WINAPI read_output_routine(LPVOID ctx);
+    static VOID CALLBACK on_exit(PVOID ctx, BOOLEAN timed_out);
+};
+
+ProcessMonitor &ProcessMonitor::instance() {
+    static ProcessMonitor inst;
+    return inst;
+}
+
+void ProcessMonitor::watch(Process &&p, Callback cb, std::chrono::milliseconds timeout) {
+    HANDLE h;
+    if (!DuplicateHandle(GetCurrentProcess(), p.pid, GetCurrentProcess(), &h, 0, FALSE, DUPLICATE_SAME_ACCESS)) {
+        throw std::system_error(GetLastError(), std::system_category(), "DuplicateHandle failed");
+    }
+    auto e = std::make_unique<Entry>();
+    e->owner = this;
+    e->process = FD(h);
+    e->cb = std::move(cb);
+    if (timeout.count() > 0) e->timeout = static_cast<DWORD>(timeout.count());
+    p.stdin_stream.reset();
+    p.child_stdin_buf.reset();
+    if (p.child_stdout_buf) {
+        e->out = FD(p.child_stdout_buf->release());
+        p.stdout_stream.reset();
+        p.child_stdout_buf.reset();
+    }
+    if (p.child_stderr_buf) {
+        e->err = FD(p.child_stderr_buf->release());
+        p.stderr_stream.reset();
+        p.child_stderr_buf.reset();
+    }
+    {
+        std::lock_guard _(_mx);
+        _entries.insert(e.get());
+    }
+    if (e->out != INVALID_HANDLE_VALUE || e->err != INVALID_HANDLE_VALUE) {
+        if (!QueueUserWorkItem(&read_output_routine, e.get(), WT_EXECUTELONGFUNCTION)) {
+            auto err = GetLastError();
+            std::lock_guard _(_mx);
+            _entries.erase(e.get());
+            throw std::system_error(err, std::system_category(), "QueueUserWorkItem failed");
+        }
+        e.release();
+    } else {
+        register_wait(e.release());
+    }
+}
+
+static void drain_pipe(FD &fd, std::string &out) {
+    if (fd == INVALID_HANDLE_VALUE) return;
+    char buff[4096];
+    DWORD rd;
+    while (ReadFile(fd, buff, sizeof(buff), &rd, NULL) && rd) {
+        out.append(buff, rd);
+    }
+    fd.close();
+}
+
+DWORD WINAPI ProcessMonitor::read_output_routine(LPVOID ctx) {
+    Entry *e = reinterpret_cast<Entry *>(ctx);
+    //both pipes must be read at once, otherwise the child blocks on full stderr
+    //while we wait for end of stdout
+    std::string err_output;
+    std::thread err_reader;
+    if (e->err != INVALID_HANDLE_VALUE) {
+        err_reader = std::thread([&]{drain_pipe(e->err, err_output);});
+    }
+    drain_pipe(e->out, e->output);
+    if (err_reader.joinable()) err_reader.join();
+    e->output.append(err_output);
+    e->owner->register_wait(e);
+    return 0;
+}
+
+void ProcessMonitor::register_wait(Entry *e) {
+    if (!RegisterWaitForSingleObject(&e->wait_handle, e->process, &on_exit, e, e->timeout, WT_EXECUTEONLYONCE)) {
+        //can't wait asynchronously, so wait synchronously
+        on_exit(e, WaitForSingleObject(e->process, e->timeout) == WAIT_TIMEOUT);
+    }
+}
+
+VOID CALLBACK ProcessMonitor::on_exit(PVOID ctx, BOOLEAN timed_out) {
+    std::unique_ptr<Entry> e(reinterpret_cast<Entry *>(ctx));
+    if (timed_out) {
+        Log::warning("Process {} timed out - killed", GetProcessId(e->process));
+        TerminateProcess(e->process, 1);
+        WaitForSingleObject(e->process, INFINITE);
+    }
+    if (e->wait_handle) UnregisterWait(e->wait_handle);
+    DWORD status = static_cast<DWORD>(-1);
+    GetExitCodeProcess(e->process, &status);
+    PROCESS_MEMORY_COUNTERS pmc = {};
+    std::size_t peak_memory = 0;
+    if (K32GetProcessMemoryInfo(e->process, &pmc, sizeof(pmc))) {
+        peak_memory = pmc.PeakWorkingSetSize;
+    }
+    {
+        std::lock_guard _(e->owner->_mx);
+        e->owner->_entries.erase(e.get());
+    }
+    e->cb(static_cast<int>(status), std::move(e->output), peak_memory);
+}
+
+void ProcessMonitor::cancel_all() {
+    std::lock_guard _(_mx);
+    for (auto e: _entries) {
+        TerminateProcess(e->process, 1);
+    }
+}
@@ -0,0 +1,165 @@
+export module cairn.utils.stats;
+
+import cairn.utils.simple_json;
+
+import <algorithm>;
+import <atomic>;
+import <chrono>;
+import <cstdint>;
+import <deque>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iostream>;
+import <mutex>;
+import <ostream>;
+import <string>;
+import <string_view>;
+
+
+///Registry of internal counters and phase timers (--stats)
+/**
+ * Counters are always collected - the cost is a relaxed atomic add. A counter is
+ * created on the first use and lives until the end of the program, so the reference
+ * can be kept in a static variable
+ *
+ * @code
+ * static auto &cnt = Stats::counter("build.outputs_checked");
+ * cnt.add();
+ * @endcode
+ */
+export class Stats {
+public:
+
+    enum class Unit {
+        count,      ///<plain number
+        bytes,      ///<size in bytes
+        time        ///<duration in nanoseconds
+    };
+
+    class Counter {
+    public:
+        Counter(std::string name, Unit unit):_name(std::move(name)),_unit(unit) {}
+
+        ///increment the counter
+        void add(std::uint64_t n = 1) {_value.fetch_add(n, std::memory_order_relaxed);}
+        ///add duration (for Unit::time)
+        void add(std::chrono::steady_clock::duration d) {
+            add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+        }
+        ///set the value (gauge)
+        void set(std::uint64_t n) {_value.store(n, std::memory_order_relaxed);}
+
+        std::uint64_t value() const {return _value.load(std::memory_order_relaxed);}
+        const std::string &name() const {return _name;}
+        Unit unit() const {return _unit;}
+
+    protected:
+        std::string _name;
+        Unit _unit;
+        std::atomic<std::uint64_t> _value = 0;
+    };
+
+    ///Retrieve counter (create new, if doesn't exist)
+    /**
+     * @param name name of the counter. Dots separates groups
+     * @param unit unit of the counter
+     * @return reference to counter, it is valid until end of the program
+     */
+    static Counter &counter(std::string_view name, Unit unit = Unit::count);
+
+    ///Retrieve timer of a phase
+    /**
+     * @param name name of the phase
+     * @return reference to the counter
+     */
+    static Counter &phase(std::string_view name) {
+        return counter(std::format("phase.{}", name), Unit::time);
+    }
+
+    ///Print all counters in human readable form
+    static void print(std::ostream &out);
+
+    ///Export all counters to json
+    /**
+     * @return object, where key is name of the counter. Times are in milliseconds
+     */
+    static Json to_json();
+
+    ///Reports statistics at the end of the scope
+    class Report {
+    public:
+        /**
+         * @param enabled set true to report statistics
+         * @param file path to json file. If empty, statistics are printed to stdout
+         */
+        Report(bool enabled, std::filesystem::path file)
+            :_enabled(enabled),_file(std::move(file)) {}
+        ~Report() {emit();}
+        ///Report statistics now (used when the program doesn't end, --watch)
+        void emit() const;
+        Report(const Report &) = delete;
+        Report &operator=(const Report &) = delete;
+    protected:
+        bool _enabled;
+        std::filesystem::path _file;
+    };
+
+protected:
+
+    struct Registry {
+        std::mutex mx;
+        std::deque<Counter> counters;
+    };
+
+    static Registry &registry() {
+        static Registry r;
+        return r;
+    }
+
+    static double to_ms(std::uint64_t ns) {return static_cast<double>(ns) / 1000000.0;}
+};
+
+Stats::Counter &Stats::counter(std::string_view name, Unit unit) {
+    auto &r = registry();
+    std::lock_guard _(r.mx);
+    for (auto &c: r.counters) {
+        if (c.name() == name) return c;
+    }
+    return r.counters.emplace_back(std::string(name), unit);
+}
+
+void Stats::print(std::ostream &out) {
+    auto &r = registry();
+    std::lock_guard _(r.mx);
+    std::size_t w = 0;
+    for (const auto &c: r.counters) w = std::max(w, c.name().size());
+    for (const auto &c: r.counters) {
+        switch (c.unit()) {
+            case Unit::time: out << std::format("{:<{}} {:>12.3f} ms\n", c.name(), w, to_ms(c.value()));break;
+            case Unit::bytes: out << std::format("{:<{}} {:>12} B\n", c.name(), w, c.value());break;
+            default: out << std::format("{:<{}} {:>12}\n", c.name(), w, c.value());break;
+        }
+    }
+}
+
+Json Stats::to_json() {
+    auto &r = registry();
+    std::lock_guard _(r.mx);
+    Json::Object out;
+    for (const auto &c: r.counters) {
+        out.emplace(c.name(), Json(c.unit() == Unit::time?to_ms(c.value()):static_cast<double>(c.value())));
+    }
+    return Json(std::move(out));
+}
+
+void Stats::Report::emit() const {
+    if (!_enabled) return;
+    if (_file.empty()) {
+        print(std::cout);
+        return;
+    }
+    std::ofstream f(_file, std::ios::out|std::ios::trunc);
+    if (!f) return;
+    to_json().serialize([&](char c){f.put(c);});
+}
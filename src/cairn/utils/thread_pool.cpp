@@ -49,6 +49,12 @@ public:
         }
     }
 
+    ///Returns count of running threads
+    std::size_t size() {
+        std::lock_guard _(_mx);
+        return _threads.size();
+    }
+
     void stop() {
         std::queue<PTask> done;
         std::vector<std::thread> threads;
@@ -90,8 +96,9 @@ protected:
 
     void worker(std::size_t idx) {
         bool exitFlg = false;
-        _exitFlags[idx] = &exitFlg;
+        //start() can still extend the vector, stop() could already take it
         std::unique_lock lk(_mx);
+        if (idx < _exitFlags.size()) _exitFlags[idx] = &exitFlg;
         while (true) {
             if (_q.empty()) {
                 _cv.wait(lk);
@@ -0,0 +1,157 @@
+export module cairn.utils.trace;
+
+import cairn.utils.simple_json;
+import cairn.utils.log;
+import cairn.utils.stats;
+
+import <atomic>;
+import <chrono>;
+import <filesystem>;
+import <fstream>;
+import <mutex>;
+import <string>;
+import <string_view>;
+import <vector>;
+import <format>;
+import <algorithm>;
+
+
+///Collects trace events of the build (Chrome trace event format)
+/**
+ * The output file can be opened in chrome://tracing or https://ui.perfetto.dev
+ *
+ * Events are collected in memory and written by save(). When tracing is not
+ * enabled, recording functions does nothing.
+ *
+ * Lane 0 is used by phases of the cairn itself, other lanes are used by
+ * parallel jobs
+ */
+export class Trace {
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    ///Enable tracing
+    /**
+     * @param file path to output file
+     */
+    static void enable(std::filesystem::path file);
+
+    ///returns true, if tracing is enabled
+    static bool is_enabled() {return _enabled.load(std::memory_order_relaxed);}
+
+    ///Record a span
+    /**
+     * @param name name of the span
+     * @param category category of the span
+     * @param lane lane
+     * @param start start time
+     * @param end end time
+     * @param args additional arguments shown with the span
+     */
+    static void record(std::string_view name, std::string_view category, unsigned int lane,
+                Clock::time_point start, Clock::time_point end, Json::Object args = {});
+
+    ///Write collected events to the output file
+    static void save();
+
+    ///Records span of a scope in lane 0
+    /**
+     * The duration is also added to the phase timer in Stats, so phases
+     * are measured even if the tracing is not enabled
+     */
+    class Scope {
+    public:
+        Scope(std::string_view name, std::string_view category = "phase")
+            :_name(name), _category(category), _start(Clock::now()) {}
+        ~Scope() {
+            auto end = Clock::now();
+            Stats::phase(_name).add(end - _start);
+            if (is_enabled()) record(_name, _category, 0, _start, end);
+        }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    protected:
+        std::string_view _name;
+        std::string_view _category;
+        Clock::time_point _start;
+    };
+
+    ///Enables tracing (if the path is not empty) and saves the trace at the end of the scope
+    class Session {
+    public:
+        Session(const std::filesystem::path &file) {
+            if (!file.empty()) enable(file);
+        }
+        ~Session() {save();}
+        Session(const Session &) = delete;
+        Session &operator=(const Session &) = delete;
+    };
+
+protected:
+
+    static std::atomic<bool> _enabled;
+    static std::mutex _mx;
+    static std::filesystem::path _file;
+    static Clock::time_point _origin;
+    static std::vector<Json> _events;
+    static unsigned int _max_lane;
+
+    static double to_us(Clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    }
+};
+
+std::atomic<bool> Trace::_enabled = false;
+std::mutex Trace::_mx;
+std::filesystem::path Trace::_file;
+Trace::Clock::time_point Trace::_origin;
+std::vector<Json> Trace::_events;
+unsigned int Trace::_max_lane = 0;
+
+void Trace::enable(std::filesystem::path file) {
+    std::lock_guard _(_mx);
+    _file = std::move(file);
+    _origin = Clock::now();
+    _events.clear();
+    _enabled = true;
+}
+
+void Trace::record(std::string_view name, std::string_view category, unsigned int lane,
+                Clock::time_point start, Clock::time_point end, Json::Object args) {
+    if (!is_enabled()) return;
+    std::lock_guard _(_mx);
+    _max_lane = std::max(_max_lane, lane);
+    _events.push_back(Json::Object{
+        {"name", Json(name)},
+        {"cat", Json(category)},
+        {"ph", Json("X")},
+        {"ts", Json(to_us(start - _origin))},
+        {"dur", Json(to_us(end - start))},
+        {"pid", Json(1.0)},
+        {"tid", Json(static_cast<double>(lane))},
+        {"args", Json(std::move(args))}
+    });
+}
+
+void Trace::save() {
+    if (!is_enabled()) return;
+    std::lock_guard _(_mx);
+    Json::Array events = _events;
+    for (unsigned int i = 0; i <= _max_lane; ++i) {
+        events.push_back(Json::Object{
+            {"name", Json("thread_name")},
+            {"ph", Json("M")},
+            {"pid", Json(1.0)},
+            {"tid", Json(static_cast<double>(i))},
+            {"args", Json(Json::Object{{"name", i?Json(std::format("job {}", i)):Json("cairn")}})}
+        });
+    }
+    std::ofstream f(_file, std::ios::out|std::ios::trunc);
+    if (!f) {
+        Log::warning("Unable to write trace: {}", _file.string());
+        return;
+    }
+    Json(Json::Object{{"traceEvents", Json(std::move(events))}}).serialize([&](char c){f.put(c);});
+    Log::verbose("Trace written: {}", _file.string());
+}
@@ -0,0 +1,326 @@
+module;
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+export module cairn.worker;
+
+import cairn.remote.protocol;
+import cairn.utils.arguments;
+import cairn.utils.hash;
+import cairn.utils.log;
+import cairn.utils.process;
+import cairn.utils.threadpool;
+
+import <algorithm>;
+import <chrono>;
+import <filesystem>;
+import <format>;
+import <fstream>;
+import <iterator>;
+import <memory>;
+import <mutex>;
+import <random>;
+import <stdexcept>;
+import <string>;
+import <string_view>;
+import <thread>;
+import <unordered_map>;
+import <utility>;
+import <vector>;
+
+export struct WorkerConfig {
+    ///[host:]port to listen
+    std::string address;
+    ///count of parallel compilations
+    unsigned int slots = 1;
+    ///the compiler - the only program, which is executed by the worker
+    std::filesystem::path compiler;
+    ///shared secret, clients must prove they know it
+    std::string secret;
+};
+
+///Run compile worker (cairn-worker)
+/**
+ * Accepts connections of clients (cairn --remote=...) and executes their
+ * compilations. Every connection is a session with its own sandbox directory,
+ * which is removed when the session ends.
+ *
+ * @param cfg configuration
+ * @return exit code
+ */
+export int run_worker(const WorkerConfig &cfg);
+
+///Session of a single client
+class WorkerSession: public std::enable_shared_from_this<WorkerSession> {
+public:
+    WorkerSession(Connection &&conn, std::filesystem::path dir, ThreadPool &pool, const WorkerConfig &cfg)
+        :_conn(std::move(conn)), _dir(std::move(dir)), _root(_dir/"root"), _blobs(_dir/"blobs")
+        ,_pool(pool), _cfg(cfg) {}
+    ~WorkerSession() {
+        std::error_code ec;
+        std::filesystem::remove_all(_dir, ec);
+    }
+
+    ///Process messages until the connection is closed
+    void run();
+
+protected:
+    Connection _conn;
+    std::filesystem::path _dir;
+    std::filesystem::path _root;
+    std::filesystem::path _blobs;
+    ThreadPool &_pool;
+    const WorkerConfig &_cfg;
+    ///client root -> sandbox (sorted by length, longest first)
+    std::vector<std::pair<ArgumentString, ArgumentString> > _arg_map;
+    std::mutex _mx;
+    std::unordered_map<std::filesystem::path, std::uint64_t> _materialized;
+
+    bool in_sandbox(const std::filesystem::path &p) const;
+    std::filesystem::path map_path(const std::filesystem::path &p) const;
+    ArgumentString map_argument(ArgumentStringView arg) const;
+    std::filesystem::path blob_path(std::uint64_t hash) const;
+    bool authenticate();
+    void materialize(const JobInput &input);
+    void execute(const MsgJob &job) noexcept;
+};
+
+static bool is_separator(ArgumentString::value_type c) {
+    return c == '/' || c == '\\';
+}
+
+bool WorkerSession::in_sandbox(const std::filesystem::path &p) const {
+    auto rel = p.lexically_relative(_root);
+    return !rel.empty() && *rel.begin() != "..";
+}
+
+std::filesystem::path WorkerSession::map_path(const std::filesystem::path &p) const {
+    auto mapped = (_root/p.relative_path()).lexically_normal();
+    //the client must not be able to touch anything outside of the sandbox
+    if (!in_sandbox(mapped)) {
+        throw std::runtime_error("path is outside of the sandbox: " + p.string());
+    }
+    return mapped;
+}
+
+ArgumentString WorkerSession::map_argument(ArgumentStringView arg) const {
+    //single pass - mapped part is never mapped again
+    ArgumentString out;
+    std::size_t pos = 0;
+    while (pos < arg.size()) {
+        auto iter = std::find_if(_arg_map.begin(), _arg_map.end(), [&](const auto &m){
+            auto end = pos + m.first.size();
+            return arg.substr(pos).starts_with(m.first) && (end == arg.size() || is_separator(arg[end]));
+        });
+        if (iter != _arg_map.end()) {
+            out.append(iter->second);
+            pos += iter->first.size();
+        } else {
+            out.push_back(arg[pos]);
+            ++pos;
+        }
+    }
+    return out;
+}
+
+std::filesystem::path WorkerSession::blob_path(std::uint64_t hash) const {
+    return _blobs/std::format("{:016x}", hash);
+}
+
+void WorkerSession::materialize(const JobInput &input) {
+    auto target = map_path(input.path);
+    {
+        std::lock_guard _(_mx);
+        auto iter = _materialized.find(target);
+        if (iter != _materialized.end() && iter->second == input.hash) return;
+    }
+    std::filesystem::create_directories(target.parent_path());
+    //link to a temporary name and rename - jobs running in parallel can share inputs
+    auto tmp = target;
+    tmp += std::format(".{}.tmp", std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::error_code ec;
+    std::filesystem::remove(tmp, ec);
+    std::filesystem::create_hard_link(blob_path(input.hash), tmp, ec);
+    if (ec) std::filesystem::copy_file(blob_path(input.hash), tmp);
+    std::filesystem::rename(tmp, target);
+    std::lock_guard _(_mx);
+    _materialized[target] = input.hash;
+}
+
+void WorkerSession::execute(const MsgJob &job) noexcept {
+    MsgResult res;
+    res.id = job.id;
+    std::string payload;
+    try {
+        for (const auto &i: job.inputs) materialize(i);
+        for (const auto &o: job.outputs) {
+            auto p = map_path(o);
+            std::filesystem::create_directories(p.parent_path());
+            //never write through a hard link to a blob
+            std::filesystem::remove(p);
+        }
+        auto workdir = map_path(job.workdir);
+        std::filesystem::create_directories(workdir);
+        for (const auto &cmd: job.commands) {
+            std::vector<ArgumentString> args;
+            for (const auto &a: cmd.arguments) args.push_back(map_argument(a));
+            //paths outside of the client's roots are not mapped, they are refused here
+            auto refused = find_refused_argument(args, workdir, [&](const std::filesystem::path &p){
+                return in_sandbox(p);
+            });
+            if (refused) {
+                const auto &a = cmd.arguments[*refused];
+                throw std::runtime_error("refused argument: " + std::string(a.begin(), a.end()));
+            }
+            auto start = std::chrono::steady_clock::now();
+            Process p = Process::spawn(_cfg.compiler, workdir, args, Process::error);
+            res.log.append(std::istreambuf_iterator<char>(*p.stderr_stream), std::istreambuf_iterator<char>());
+            int status = p.waitpid_status();
+            auto dur = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            res.phases.push_back({cmd.phase, static_cast<std::uint64_t>(dur.count()), status});
+            if (status) {
+                res.status = status;
+                break;
+            }
+        }
+        if (res.status == 0) {
+            for (const auto &o: job.outputs) {
+                std::ifstream in(map_path(o), std::ios::in|std::ios::binary);
+                if (!in) {
+                    res.status = -1;
+                    res.log.append("cairn-worker: missing output: ").append(o.string()).append("\n");
+                    break;
+                }
+                auto sz = payload.size();
+                payload.append(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                res.output_sizes.push_back(payload.size() - sz);
+            }
+        }
+    } catch (const std::exception &e) {
+        res.status = -1;
+        res.log.append("cairn-worker: ").append(e.what()).append("\n");
+    }
+    if (res.status) payload.clear();
+    //diagnostics refer to the client's paths
+    auto sandbox = _root.string();
+    for (auto pos = res.log.find(sandbox); pos != res.log.npos; pos = res.log.find(sandbox, pos)) {
+        res.log.erase(pos, sandbox.size());
+    }
+    try {
+        _conn.send(MsgType::result, res, payload);
+    } catch (const std::exception &e) {
+        Log::warning("Worker: failed to send result: {}", e.what());
+    }
+}
+
+static std::string generate_nonce() {
+    std::random_device rd;
+    std::string out;
+    for (int i = 0; i < 32; ++i) out.push_back(static_cast<char>(rd()));
+    return out;
+}
+
+///compare without early exit - time must not depend on the content
+static bool equal_digest(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    unsigned char diff = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) diff |= static_cast<unsigned char>(a[i] ^ b[i]);
+    return diff == 0;
+}
+
+bool WorkerSession::authenticate() {
+    if (_conn.receive() != MsgType::hello) return false;
+    MsgHello hello;
+    _conn.read_header(hello);
+    _conn.read_payload();
+    MsgChallenge challenge;
+    challenge.nonce = generate_nonce();
+    _conn.send(MsgType::challenge, challenge);
+    if (hello.version != remote_protocol_version) {
+        Log::warning("Worker: client uses incompatible protocol version {}", hello.version);
+        return false;
+    }
+    if (_conn.receive() != MsgType::auth) return false;
+    MsgAuth auth;
+    _conn.read_header(auth);
+    _conn.read_payload();
+    if (!equal_digest(auth.response, hmac_sha256(_cfg.secret, challenge.nonce))) {
+        Log::warning("Worker: client failed to authenticate");
+        return false;
+    }
+    for (const auto &r: hello.roots) {
+        _arg_map.push_back({path_arg(r), path_arg(map_path(r))});
+    }
+    MsgWelcome welcome;
+    welcome.slots = _cfg.slots;
+    welcome.compiler = _cfg.compiler.string();
+#ifndef _WIN32
+    char name[256] = {};
+    ::gethostname(name, sizeof(name)-1);
+    welcome.name = name;
+#endif
+    _conn.send(MsgType::welcome, welcome);
+    return true;
+}
+
+void WorkerSession::run() {
+    if (!authenticate()) return;
+    std::sort(_arg_map.begin(), _arg_map.end(), [](const auto &a, const auto &b){
+        return a.first.size() > b.first.size();
+    });
+    std::filesystem::create_directories(_blobs);
+    while (auto t = _conn.receive()) {
+        switch (*t) {
+            case MsgType::blob: {
+                MsgBlob blob;
+                _conn.read_header(blob);
+                auto data = _conn.read_payload();
+                auto p = blob_path(blob.hash);
+                auto tmp = p;
+                tmp += ".tmp";
+                std::ofstream out(tmp, std::ios::out|std::ios::trunc|std::ios::binary);
+                out.write(data.data(), static_cast<std::streamsize>(data.size()));
+                out.close();
+                std::filesystem::rename(tmp, p);
+            } break;
+            case MsgType::job: {
+                auto job = std::make_shared<MsgJob>();
+                _conn.read_header(*job);
+                _conn.read_payload();
+                _pool.push([me = shared_from_this(), job]() noexcept {me->execute(*job);});
+            } break;
+            default:
+                throw std::runtime_error("unexpected message");
+        }
+    }
+}
+
+int run_worker(const WorkerConfig &cfg) {
+    Listener listener(cfg.address);
+    if (cfg.secret.empty() && !listener.is_loopback()) {
+        Log::error("Worker: a shared secret (--secret) is required to listen on a network address: {}", cfg.address);
+        return 1;
+    }
+    ThreadPool pool;
+    pool.start(cfg.slots);
+    auto base = std::filesystem::temp_directory_path()/"cairn-worker";
+    auto stamp = std::chrono::system_clock::now().time_since_epoch().count();
+    unsigned int counter = 0;
+    Log::verbose("Worker: listening on {}, {} slots, compiler {}", cfg.address, cfg.slots, cfg.compiler.string());
+    while (true) {
+        auto conn = listener.accept();
+        auto dir = base/std::format("session-{}-{}", stamp, ++counter);
+        auto session = std::make_shared<WorkerSession>(std::move(conn), dir, pool, cfg);
+        std::thread([session]{
+            try {
+                Log::verbose("Worker: session started");
+                session->run();
+            } catch (const std::exception &e) {
+                Log::warning("Worker: session failed: {}", e.what());
+            }
+            Log::verbose("Worker: session finished");
+        }).detach();
+    }
+}
@@ -0,0 +1,83 @@
+import cairn.build_plan;
+import <iostream>;
+import <string_view>;
+import <vector>;
+
+//Tests of the dispatch order of BuildPlan
+//
+//usage: build_plan_test
+//
+//Prints failed checks, exit code is count of failures
+
+static int failures = 0;
+
+static void check(bool cond, std::string_view what) {
+    if (!cond) {
+        std::cerr << "FAILED: " << what << "\n";
+        ++failures;
+    }
+}
+
+using Plan = BuildPlan<int>;
+
+//collects ids of all ready targets in order of dispatch
+static std::vector<Plan::TargetID> dispatch(const Plan &plan, Plan::State &st) {
+    std::vector<Plan::TargetID> out;
+    plan.prepare_actions(st, [&](Plan::TargetID id, const int &) {
+        out.push_back(id);
+        return true;
+    });
+    return out;
+}
+
+static void test_critical_path() {
+    Plan plan;
+    auto a = plan.create_target(0, "a", 1);
+    auto b = plan.create_target(1, "b", 10);
+    auto c = plan.create_target(2, "c", 100);
+    auto d = plan.create_target(3, "d", 5);
+    plan.add_dependency(c, a);
+    plan.add_dependency(d, b);
+    plan.add_dependency(d, c);
+
+    auto st = plan.initialize_state();
+    auto first = dispatch(plan, st);
+    //a -> c -> d = 106, b -> d = 15
+    check(first == std::vector<Plan::TargetID>{a, b}, "cheap target on the critical path goes first");
+    plan.mark_done(st, b);
+    check(dispatch(plan, st).empty(), "d waits for c");
+    plan.mark_done(st, a);
+    check(dispatch(plan, st) == std::vector<Plan::TargetID>{c}, "c is released by a");
+    plan.mark_done(st, c);
+    check(dispatch(plan, st) == std::vector<Plan::TargetID>{d}, "d is released by the last dependency");
+    plan.mark_done(st, d);
+    check(plan.prepare_actions(st, [](Plan::TargetID, const int &){return true;}), "all done");
+}
+
+static void test_order_of_creation() {
+    Plan plan;
+    auto a = plan.create_target(0, "a", 3);
+    auto b = plan.create_target(1, "b", 3);
+    auto c = plan.create_target(2, "c", 3);
+    auto st = plan.initialize_state();
+    check(dispatch(plan, st) == std::vector<Plan::TargetID>{a, b, c}, "equal priority keeps order of creation");
+}
+
+static void test_refused_target() {
+    Plan plan;
+    auto a = plan.create_target(0, "a", 1);
+    auto b = plan.create_target(1, "b", 2);
+    auto st = plan.initialize_state();
+    int calls = 0;
+    bool done = plan.prepare_actions(st, [&](Plan::TargetID, const int &){++calls;return false;});
+    check(!done && calls == 1, "enumeration stops at the refused target");
+    check(dispatch(plan, st) == std::vector<Plan::TargetID>{b, a}, "refused target is offered again");
+}
+
+int main() {
+    test_critical_path();
+    test_order_of_creation();
+    test_refused_target();
+    if (failures == 0) std::cout << "build_plan: all tests passed\n";
+    return failures;
+}
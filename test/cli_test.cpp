@@ -0,0 +1,61 @@
+import cairn.cli;
+import cairn.utils.arguments;
+import <cstddef>;
+import <iostream>;
+import <limits>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Tests of the command line parser
+//
+//usage: cli_test
+//
+//Prints failed checks, exit code is count of failures
+
+static int failures = 0;
+
+static void check(bool cond, std::string_view what) {
+    if (!cond) {
+        std::cerr << "FAILED: " << what << "\n";
+        ++failures;
+    }
+}
+
+//parses given arguments followed by the compiler, returns result of parse_cmdline
+static bool parse(AppSettings &settings, std::vector<std::string> args) {
+    args.push_back("clang++");
+    std::vector<ArgumentString> strs;
+    for (const auto &a: args) strs.push_back(string_arg(a));
+    std::vector<ArgumentString::value_type *> argv;
+    for (auto &s: strs) argv.push_back(s.data());
+    CliReader<ArgumentString::value_type> cli(static_cast<int>(argv.size()), argv.data());
+    return parse_cmdline(settings, cli);
+}
+
+static std::size_t mem_budget(const std::string &value) {
+    AppSettings settings;
+    if (!parse(settings, {"--mem-budget=" + value})) return 0;
+    return settings.memory_budget;
+}
+
+static void test_mem_budget() {
+    constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
+    check(mem_budget("1000") == 1000, "size without suffix");
+    check(mem_budget("16k") == 16384, "lowercase suffix");
+    check(mem_budget("4G") == (std::size_t(4) << 30), "suffix G");
+    check(mem_budget(std::to_string(max)) == max, "largest size");
+    check(mem_budget(std::to_string(max) + "0") == 0, "overflow of digits is refused");
+    check(mem_budget(std::to_string((max >> 20) + 1) + "M") == 0, "overflow of the suffix is refused");
+    check(mem_budget(std::to_string(max >> 20) + "M") == ((max >> 20) << 20), "largest size with suffix");
+    check(mem_budget("") == 0, "empty size is refused");
+    check(mem_budget("G") == 0, "suffix without number is refused");
+    check(mem_budget("4GB") == 0, "unknown suffix is refused");
+    check(mem_budget("4X") == 0, "unknown suffix letter is refused");
+}
+
+int main() {
+    test_mem_budget();
+    if (failures == 0) std::cout << "cli: all tests passed\n";
+    return failures;
+}
@@ -0,0 +1,124 @@
+import cairn.utils.hash;
+import <cstdint>;
+import <filesystem>;
+import <fstream>;
+import <iostream>;
+import <string>;
+import <string_view>;
+
+//Tests of hash functions
+//
+//usage: hash_test
+//
+//Prints failed checks, exit code is count of failures
+
+static int failures = 0;
+
+static void check(bool cond, std::string_view what) {
+    if (!cond) {
+        std::cerr << "FAILED: " << what << "\n";
+        ++failures;
+    }
+}
+
+static std::uint64_t content_hash(std::string_view data) {
+    ContentHash h;
+    h.update(data);
+    return h.value();
+}
+
+static void test_content_hash() {
+    std::string text;
+    for (int i = 0; i < 100; ++i) text.push_back(static_cast<char>('a' + i % 26));
+    auto whole = content_hash(text);
+    bool same = true;
+    for (std::size_t i = 0; i <= text.size(); ++i) {
+        ContentHash h;
+        h.update(std::string_view(text).substr(0, i));
+        h.update(std::string_view(text).substr(i));
+        same = same && h.value() == whole;
+    }
+    check(same, "result doesn't depend on splitting of the content");
+    ContentHash bytes;
+    for (char c: text) bytes.update(std::string_view(&c, 1));
+    check(bytes.value() == whole, "update by single bytes");
+
+    check(content_hash("") != 0, "empty content has nonzero hash");
+    check(content_hash("") != content_hash(std::string(1, '\0')), "length is part of the hash");
+    check(content_hash("12345678") != content_hash("12345679"), "change of a full word");
+    check(content_hash("123456789") != content_hash("123456788"), "change of the tail");
+    text[50] ^= 1;
+    check(content_hash(text) != whole, "change of a single bit");
+}
+
+static void test_hash_file() {
+    auto path = std::filesystem::temp_directory_path()/"cairn_hash_test.bin";
+    std::string content(200000, 'x');
+    content[100000] = 'y';
+    {
+        std::ofstream f(path, std::ios::out|std::ios::binary|std::ios::trunc);
+        f.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+    check(hash_file(path) == content_hash(content), "hash of a file is hash of its content");
+    std::filesystem::remove(path);
+    check(hash_file(path) == 0, "missing file has zero hash");
+}
+
+static std::string to_hex(std::string_view bin) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string out;
+    for (char c: bin) {
+        auto b = static_cast<unsigned char>(c);
+        out.push_back(digits[b >> 4]);
+        out.push_back(digits[b & 0xF]);
+    }
+    return out;
+}
+
+static std::string sha256(std::string_view data) {
+    Sha256 h;
+    h.update(data);
+    return to_hex(h.digest());
+}
+
+//FIPS 180-4 examples
+static void test_sha256() {
+    check(sha256("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", "sha256 of empty message");
+    check(sha256("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "sha256 of one block");
+    check(sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")
+            == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", "sha256 padding in the next block");
+    Sha256 h;
+    std::string chunk(1000, 'a');
+    for (int i = 0; i < 1000; ++i) h.update(chunk);
+    check(to_hex(h.digest()) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", "sha256 of million 'a'");
+}
+
+//RFC 4231 test cases (except 5, which truncates the result)
+static void test_hmac_sha256() {
+    auto hmac = [](std::string_view key, std::string_view msg) {return to_hex(hmac_sha256(key, msg));};
+    std::string key4;
+    for (char c = 1; c <= 25; ++c) key4.push_back(c);
+    std::string long_key(131, '\xaa');
+    check(hmac(std::string(20, '\x0b'), "Hi There")
+            == "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", "RFC 4231 test case 1");
+    check(hmac("Jefe", "what do ya want for nothing?")
+            == "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", "RFC 4231 test case 2");
+    check(hmac(std::string(20, '\xaa'), std::string(50, '\xdd'))
+            == "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe", "RFC 4231 test case 3");
+    check(hmac(key4, std::string(50, '\xcd'))
+            == "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b", "RFC 4231 test case 4");
+    check(hmac(long_key, "Test Using Larger Than Block-Size Key - Hash Key First")
+            == "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54", "RFC 4231 test case 6");
+    check(hmac(long_key, "This is a test using a larger than block-size key and a larger than block-size data."
+                         " The key needs to be hashed before being used by the HMAC algorithm.")
+            == "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2", "RFC 4231 test case 7");
+}
+
+int main() {
+    test_content_hash();
+    test_hash_file();
+    test_sha256();
+    test_hmac_sha256();
+    if (failures == 0) std::cout << "hash: all tests passed\n";
+    return failures;
+}
@@ -0,0 +1,6 @@
+export module lib0.m0;
+
+export {
+    int m0();
+}
+import lib1.m1;
@@ -0,0 +1,12 @@
+module;
+#include "config.h"
+#include "with space.h"
+export module lib0.m0;
+
+export import :p0;
+import lib1.m1;
+  export   import lib2.m2 ;
+
+export int m0() {
+    return 0;
+}
@@ -0,0 +1,5 @@
+import lib0.m0;
+
+int main() {
+    return m0();
+}
@@ -0,0 +1,120 @@
+import cairn.p1689_scanner;
+import cairn.source_scanner;
+import cairn.module_type;
+import cairn.utils.simple_json;
+import <algorithm>;
+import <filesystem>;
+import <fstream>;
+import <iostream>;
+import <iterator>;
+import <optional>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Tests of the P1689 scanner against output of clang-scan-deps
+//
+//usage: p1689_test <fixtures directory>
+//
+//scan_deps.json - output of clang-scan-deps -format=p1689 (batch of 3 files)
+//scan_deps.d    - output of clang-scan-deps -format=make of the same batch
+//m0.cpp         - source of the interface of the batch (exported imports)
+//
+//Prints failed checks, exit code is count of failures
+
+static int failures = 0;
+
+static void check(bool cond, std::string_view what) {
+    if (!cond) {
+        std::cerr << "FAILED: " << what << "\n";
+        ++failures;
+    }
+}
+
+static std::string read_file(const std::filesystem::path &path) {
+    std::ifstream f(path, std::ios::in|std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+static std::optional<Json> load_json(const std::filesystem::path &path) {
+    std::ifstream f(path);
+    if (!f) return std::nullopt;
+    return Json::parse([&]() -> std::optional<char> {
+        int c = f.get();
+        if (c == EOF) return std::nullopt;
+        return static_cast<char>(c);
+    });
+}
+
+static bool has_reference(const std::vector<SourceScanner::Reference> &refs, ModuleType type, std::string_view name) {
+    return std::any_of(refs.begin(), refs.end(), [&](const SourceScanner::Reference &r){
+        return r.type == type && r.name == name;
+    });
+}
+
+static void test_rules(const std::filesystem::path &dir) {
+    auto json = load_json(dir/"scan_deps.json");
+    check(json.has_value(), "scan_deps.json is parsed");
+    if (!json) return;
+    const auto &rules = json->as_object().at("rules").as_array();
+    check(rules.size() == 3, "3 rules");
+    if (rules.size() != 3) return;
+
+    auto m0 = p1689_rule_to_info(rules[0]);
+    check(m0.type == ModuleType::interface && m0.name == "lib0.m0", "interface lib0.m0");
+    check(m0.required.size() == 3, "interface requires 3 modules");
+    check(has_reference(m0.required, ModuleType::partition, "lib0.m0:p0"), "partition import");
+    check(has_reference(m0.required, ModuleType::interface, "lib1.m1"), "module import");
+    //conservative result - P1689 doesn't tell which imports are exported
+    check(m0.exported.size() == 3, "all imports exported before the source is read");
+
+    p1689_detect_exports(dir/"m0.cpp", m0);
+    check(m0.exported.size() == 2, "exported imports recovered from the source");
+    check(has_reference(m0.exported, ModuleType::partition, "lib0.m0:p0"), "export import :p0");
+    check(has_reference(m0.exported, ModuleType::interface, "lib2.m2"), "export import lib2.m2");
+    check(!has_reference(m0.exported, ModuleType::interface, "lib1.m1"), "import lib1.m1 is not exported");
+
+    auto block = p1689_rule_to_info(rules[0]);
+    p1689_detect_exports(dir/"export_block.cpp", block);
+    check(block.exported.size() == 3, "export block keeps conservative result");
+
+    auto p0 = p1689_rule_to_info(rules[1]);
+    check(p0.type == ModuleType::partition && p0.name == "lib0.m0:p0", "partition lib0.m0:p0");
+    check(p0.required.empty(), "rule without requires");
+
+    auto main = p1689_rule_to_info(rules[2]);
+    check(main.type == ModuleType::source && main.name.empty(), "source without provides");
+    check(has_reference(main.required, ModuleType::interface, "lib0.m0"), "source imports lib0.m0");
+    p1689_detect_implementation(dir/"main.cpp", main);
+    check(main.type == ModuleType::source, "importing source is not an implementation");
+}
+
+static void test_make_output(const std::filesystem::path &dir) {
+    auto rules = parse_depfile_rules(read_file(dir/"scan_deps.d"), "/work");
+    check(rules.size() == 3, "3 make rules");
+    if (rules.size() != 3) return;
+    check(rules[0].target == "/work/.build/p1689/batch0_0.o", "target of the first rule");
+    check(rules[0].dependencies.size() == 3, "continuation line");
+    check(rules[0].dependencies.size() == 3 && rules[0].dependencies[2] == "/work/include/with space.h", "escaped space");
+    check(rules[1].dependencies.size() == 1, "rule with the source only");
+    check(rules[2].target == "/work/.build/p1689/batch0_2.o", "target of the last rule");
+    check(rules[2].dependencies.size() == 4, "dependencies of the last rule");
+
+    auto includes = parse_depfile(read_file(dir/"scan_deps.d"), "/work", "/work/lib0/m0.cpp");
+    check(includes.size() == 2, "source is not reported as included");
+
+    check(parse_depfile_rules("", "/work").empty(), "empty depfile has no rules");
+    check(parse_depfile("", "/work", "/work/main.cpp").empty(), "empty depfile has no includes");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: p1689_test <fixtures directory>\n";
+        return 1;
+    }
+    std::filesystem::path dir = argv[1];
+    test_rules(dir);
+    test_make_output(dir);
+    if (failures == 0) std::cout << "p1689: all tests passed\n";
+    return failures;
+}
@@ -0,0 +1,110 @@
+import cairn.preprocess;
+import cairn.utils.stats;
+import <filesystem>;
+import <fstream>;
+import <iostream>;
+import <string>;
+import <string_view>;
+import <vector>;
+
+//Tests of the preprocessor
+//
+//usage: preprocess_test
+//
+//Prints failed checks, exit code is count of failures
+
+static int failures = 0;
+
+static void check(bool cond, std::string_view what) {
+    if (!cond) {
+        std::cerr << "FAILED: " << what << "\n";
+        ++failures;
+    }
+}
+
+using Lines = std::vector<std::string>;
+
+static Lines copy_lines(StupidPreprocessor &pp, const std::filesystem::path &dir, std::string_view text) {
+    Lines out;
+    pp.run(dir, text, StupidPreprocessor::ScanMode::copy, [&](std::string_view ln){
+        out.emplace_back(ln);
+        return true;
+    });
+    return out;
+}
+
+static Lines copy_lines(std::string_view text) {
+    StupidPreprocessor pp;
+    return copy_lines(pp, std::filesystem::current_path(), text);
+}
+
+//lines without comments and continuations are taken directly from the text,
+//other lines are processed character by character. Both must continue at the right place
+static void test_line_reader() {
+    check(copy_lines("a\nb") == Lines{"a", "b"}, "last line without newline");
+    check(copy_lines("a\n\nb\n") == Lines{"a", "", "b", ""}, "empty lines");
+    check(copy_lines("a\r\nb\r\n") == Lines{"a", "b", ""}, "CRLF");
+    check(copy_lines("a\rb\nc") == Lines{"ab", "c"}, "CR inside of a line");
+    check(copy_lines("x = a / b;\ny") == Lines{"x = a / b;", "y"}, "slash without comment");
+    check(copy_lines("p // c\nq\nr") == Lines{"p ", "q", "r"}, "line comment followed by plain lines");
+    check(copy_lines("/* x\n y */ a\nb") == Lines{" a", "b"}, "block comment over two lines");
+    check(copy_lines("a \\\nb\nc") == Lines{"a b", "c"}, "continued line");
+    check(copy_lines("a \\\r\nb\r\nc") == Lines{"a b", "c"}, "continued line with CRLF");
+    check(copy_lines("#define X 1\n#if X // c\nyes\n#endif\nno") == Lines{"yes", "no"}, "comment in a directive");
+
+    //block comment across the 64KB boundary of the file
+    std::string text(65530, 'x');
+    text.append("/* long\ncomment */\nafter\n");
+    auto path = std::filesystem::temp_directory_path()/"cairn_preprocess_test.cpp";
+    {
+        std::ofstream f(path, std::ios::out|std::ios::binary|std::ios::trunc);
+        f.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+    StupidPreprocessor pp;
+    Lines out;
+    pp.run(path.parent_path(), path, [&](std::string_view ln){
+        out.emplace_back(ln);
+        return true;
+    });
+    std::filesystem::remove(path);
+    check(out == Lines{std::string(65530, 'x'), "after", ""}, "large file");
+}
+
+//a header is memoized in at most 8 variants of the macro state, copies of the
+//preprocessor share the memo
+static void test_header_cache() {
+    auto dir = std::filesystem::temp_directory_path()/"cairn_preprocess_test";
+    std::filesystem::create_directories(dir);
+    {
+        std::ofstream f(dir/"variant.h", std::ios::out|std::ios::trunc);
+        f << "#if VARIANT >= 0\n#define RESULT VARIANT\n#endif\n";
+    }
+    auto &hits = Stats::counter("preprocessor.header_cache_hits");
+    auto &misses = Stats::counter("preprocessor.header_cache_misses");
+    StupidPreprocessor base;
+    base.append_includes(dir);
+    auto scan = [&](int variant) {
+        StupidPreprocessor pp = base;
+        pp.define_symbol("VARIANT", std::to_string(variant));
+        auto out = copy_lines(pp, dir, "#include <variant.h>\n#if RESULT == " + std::to_string(variant) + "\nok\n#endif\nend");
+        return out == Lines{"ok", "end"};
+    };
+    bool correct = true;
+    auto h = hits.value();
+    auto m = misses.value();
+    for (int i = 0; i < 12; ++i) correct = scan(i) && correct;
+    check(hits.value() == h && misses.value() == m + 12, "new variants are processed");
+    h = hits.value();
+    m = misses.value();
+    for (int i = 0; i < 12; ++i) correct = scan(i) && correct;
+    check(hits.value() == h + 8 && misses.value() == m + 4, "first 8 variants are memoized");
+    check(correct, "memoized header has the same effect");
+    std::filesystem::remove_all(dir);
+}
+
+int main() {
+    test_line_reader();
+    test_header_cache();
+    if (failures == 0) std::cout << "preprocess: all tests passed\n";
+    return failures;
+}